@@ -0,0 +1,49 @@
+/**
+ * @file BatchPricer.h
+ * @brief Pipelined pricing of a trade file: chunked parsing, parallel
+ *        pricing workers and ordered streaming of the results.
+ */
+
+#ifndef BATCHPRICER_H
+#define BATCHPRICER_H
+
+#include <cstdint>
+#include <string>
+#include "TradeIO.h"
+
+/**
+ * @brief Batch pipeline controls.
+ */
+struct BatchSettings {
+    int workers = 0;              ///< Pricing threads (0 = hardware concurrency)
+    int chunkRows = 64;           ///< Trades per chunk
+    int maxChunksInFlight = 0;    ///< Memory bound (0 = 2 * workers + 2)
+    double bumpS = 1.0;           ///< Bump in S (Gamma)
+    double bumpSigma = 0.0001;    ///< Bump in sigma (Heston vega)
+    double bumpR = 0.01;          ///< Bump in r (Rho)
+    double bumpT = 1.0 / 365.0;   ///< Bump in T (Theta)
+    unsigned long seed = 12345UL; ///< RNG seed shared by all trades
+};
+
+/**
+ * @brief Price every trade of a file and stream the results to another.
+ *
+ * A reader thread parses the input in chunks, worker threads price the
+ * chunks with `compute_greeks_MC`, and the calling thread writes finished
+ * chunks in input order. At most `maxChunksInFlight` chunks exist at any
+ * time, so memory stays flat regardless of the file size and parsing
+ * overlaps with simulation.
+ *
+ * @param inputPath Trade file (CSV or binary, detected from content).
+ * @param outputPath Result file.
+ * @param outputFormat Result file format.
+ * @param settings Pipeline controls.
+ * @return Number of trades priced.
+ * @throw std::runtime_error on I/O or parse errors (from any stage).
+ */
+std::uint64_t price_trade_file(const std::string& inputPath,
+                               const std::string& outputPath,
+                               FileFormat outputFormat,
+                               const BatchSettings& settings = {});
+
+#endif // BATCHPRICER_H
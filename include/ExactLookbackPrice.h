@@ -37,4 +37,36 @@ double lookback_put_exact(double S0,
                           double sigma,
                           double T);
 
+/**
+ * @brief Analytic vega (d price / d sigma) of `lookback_call_exact`.
+ *
+ * @param S0 Current spot price.
+ * @param Smin Minimum observed spot along the path.
+ * @param r Risk-free rate.
+ * @param sigma Volatility.
+ * @param T Time to maturity.
+ * @return Exact call vega.
+ */
+double lookback_call_exact_vega(double S0,
+                                double Smin,
+                                double r,
+                                double sigma,
+                                double T);
+
+/**
+ * @brief Analytic vega (d price / d sigma) of `lookback_put_exact`.
+ *
+ * @param S0 Current spot price.
+ * @param Smax Maximum observed spot along the path.
+ * @param r Risk-free rate.
+ * @param sigma Volatility.
+ * @param T Time to maturity.
+ * @return Exact put vega.
+ */
+double lookback_put_exact_vega(double S0,
+                               double Smax,
+                               double r,
+                               double sigma,
+                               double T);
+
 #endif // EXACTLOOKBACKPRICE_H
\ No newline at end of file
@@ -6,6 +6,8 @@
 #ifndef GREEKS_H
 #define GREEKS_H
 
+#include <functional>
+#include <vector>
 #include "LookbackOption.h"
 
 /**
@@ -18,14 +20,30 @@ struct Greeks {
     double theta;   ///< Sensitivity w.r.t. time to maturity
     double vega;    ///< Sensitivity w.r.t. volatility
     double rho;     ///< Sensitivity w.r.t. interest rate
+    double stdError; ///< Standard error of the price estimate
 };
 
+/**
+ * @brief Intermediate result published by `compute_greeks_MC_progressive`.
+ */
+struct GreeksProgress {
+    int nPaths;      ///< Paths simulated so far
+    Greeks greeks;   ///< Estimates over those paths
+};
+
+/**
+ * @brief Progress callback; return false to stop refining.
+ */
+using GreeksCallback = std::function<bool(const GreeksProgress&)>;
+
 /**
  * @brief Compute option price and Greeks using Monte Carlo finite differences.
  *
  * @param base Base Monte Carlo parameters.
  * @param bumpS Bump size for underlying price (for Gamma calculation).
- * @param bumpSigma Bump size for volatility (unused pathwise here).
+ * @param bumpSigma Bump size for volatility (Heston only, where the bump used
+ *                  is max(bumpSigma, 0.05 * sigma); Black-Scholes vega is
+ *                  pathwise).
  * @param bumpR Bump size for interest rate (for Rho calculation).
  * @param bumpT Bump size for maturity (for Theta calculation).
  * @param seed RNG seed for reproducible runs.
@@ -38,4 +56,47 @@ Greeks compute_greeks_MC(const MCParams& base,
                          double bumpT,     // bump for maturity
                          unsigned long seed);
 
+/**
+ * @brief Compute option price and Greeks, publishing estimates at path
+ *        milestones.
+ *
+ * The estimators are advanced together, so each update costs no extra
+ * simulation and the update at `base.nPaths` equals `compute_greeks_MC`.
+ *
+ * @param base Base Monte Carlo parameters.
+ * @param bumpS Bump size for underlying price.
+ * @param bumpSigma Bump size for volatility (see `compute_greeks_MC`).
+ * @param bumpR Bump size for interest rate.
+ * @param bumpT Bump size for maturity.
+ * @param seed RNG seed for reproducible runs.
+ * @param milestones Ascending path counts at which to publish; `base.nPaths`
+ *                   is always the last one.
+ * @param onUpdate Called at each milestone; returning false cancels the run.
+ * @param cancelled Optional predicate polled every `kPathBlock` paths; when
+ *                  it returns true, the estimates so far are published
+ *                  through `onUpdate` and the run stops.
+ * @return Greeks at the last published update.
+ */
+Greeks compute_greeks_MC_progressive(const MCParams& base,
+                                     double bumpS,
+                                     double bumpSigma,
+                                     double bumpR,
+                                     double bumpT,
+                                     unsigned long seed,
+                                     const std::vector<int>& milestones,
+                                     const GreeksCallback& onUpdate,
+                                     const std::function<bool()>& cancelled = nullptr);
+
+/**
+ * @brief Geometric schedule of path milestones ending at `nPaths`.
+ *
+ * @param nPaths Total number of paths.
+ * @param first First milestone (default = 1000).
+ * @param factor Growth factor between milestones (default = 4).
+ * @return Ascending milestones, the last being `nPaths`.
+ */
+std::vector<int> progressive_milestones(int nPaths,
+                                        int first = 1000,
+                                        double factor = 4.0);
+
 #endif // GREEKS_H
\ No newline at end of file
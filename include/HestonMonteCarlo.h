@@ -0,0 +1,69 @@
+/**
+ * @file HestonMonteCarlo.h
+ * @brief Monte Carlo engine for simulating price paths under the Heston
+ *        stochastic volatility model (Andersen QE discretization).
+ */
+
+#ifndef HESTONMONTECARLO_H
+#define HESTONMONTECARLO_H
+
+#include <vector>
+#include <random>
+#include "PathModel.h"
+
+class HestonMonteCarlo : public PathModel {
+public:
+    /**
+     * @brief Construct a Heston engine.
+     *
+     * All per-step constants of the QE scheme are computed here, once per run.
+     *
+     * @param S0 Initial asset price.
+     * @param r Risk-free rate.
+     * @param v0 Initial variance.
+     * @param heston Variance-process parameters.
+     * @param T Time to maturity.
+     * @param nSteps Number of time steps per path.
+     * @param seed RNG seed.
+     */
+    HestonMonteCarlo(double S0,
+                     double r,
+                     double v0,
+                     const HestonParams& heston,
+                     double T,
+                     int nSteps,
+                     unsigned long seed);
+
+    /**
+     * @brief Simulate a block of paths, all lanes stepped together.
+     */
+    void simulate_block(int nPaths,
+                        double* ST,
+                        double* Smin,
+                        double* Smax) override;
+
+private:
+    // Initial state
+    double logS0;   // log of initial asset price
+    double v0;      // initial variance
+    int nSteps;     // number of time steps
+
+    // QE constants (uniform grid, so one set serves every step)
+    double mA, mB;      // conditional variance mean    m  = mA  + mB  * v
+    double s2A, s2B;    // conditional variance var     s2 = s2A + s2B * v
+    double K0;          // log-spot drift incl. r * dt
+    double K1, K2;      // log-spot weights of v(t) and v(t+dt)
+    double K3, K4;      // log-spot variance weights of v(t) and v(t+dt)
+    bool deterministicVariance;   // xi == 0: v follows its conditional mean
+
+    // Structure-of-arrays block state
+    std::vector<double> logS, v, vNext, logMin, logMax;
+    std::vector<double> Zv, U, Zs;
+
+    // Random number generation
+    std::mt19937_64 rng;
+    std::normal_distribution<double> normal;
+    std::uniform_real_distribution<double> uniform;
+};
+
+#endif // HESTONMONTECARLO_H
@@ -0,0 +1,85 @@
+/**
+ * @file ImpliedVolatility.h
+ * @brief Batch implied volatility of floating-strike lookback quotes, from
+ *        the exact formulas or from Monte Carlo with common random numbers.
+ */
+
+#ifndef IMPLIEDVOLATILITY_H
+#define IMPLIEDVOLATILITY_H
+
+#include <vector>
+#include "LookbackOption.h"
+
+class NormalCube;
+
+/**
+ * @brief A quoted lookback option to invert.
+ */
+struct LookbackQuote {
+    double price;        ///< Quoted option price
+    double S0;           ///< Current spot price
+    double Sext;         ///< Running minimum (call) or maximum (put) so far
+    double r;            ///< Risk-free rate (non-zero for the exact formulas)
+    double T;            ///< Time to maturity
+    LookbackType type;   ///< Option type (Call/Put)
+};
+
+/**
+ * @brief Solver controls.
+ */
+struct ImpliedVolSettings {
+    double sigmaMin  = 0.01;    ///< Lower end of the search bracket
+    double sigmaMax  = 2.0;     ///< Upper end of the search bracket
+    double sigmaInit = 0.3;     ///< First Newton iterate
+    double priceTol  = 1e-10;   ///< Stop when |price - quote| is below this
+    double sigmaTol  = 1e-12;   ///< Stop when the bracket is narrower than this
+    int maxIter      = 100;     ///< Maximum number of Newton/bisection steps
+};
+
+/**
+ * @brief Outcome of one inversion.
+ */
+struct ImpliedVolResult {
+    double sigma;      ///< Implied volatility (best iterate if not converged)
+    int iterations;    ///< Price/vega evaluations after bracketing
+    bool converged;    ///< False if the quote is not bracketed or maxIter hit
+};
+
+/**
+ * @brief Implied volatilities from `lookback_call_exact`/`lookback_put_exact`.
+ *
+ * Safeguarded Newton on the analytic vega: iterates leaving the bracket
+ * fall back to bisection. All quotes are iterated in lockstep.
+ *
+ * @param quotes Quotes to invert.
+ * @param settings Solver controls.
+ * @return One result per quote.
+ */
+std::vector<ImpliedVolResult> implied_vol_exact(const std::vector<LookbackQuote>& quotes,
+                                                const ImpliedVolSettings& settings = {});
+
+/**
+ * @brief Implied volatilities from Monte Carlo prices with fixed normals.
+ *
+ * Every iteration and every quote uses the same normals, read from `cube`
+ * or regenerated from `seed` path by path, so the objective is smooth in
+ * sigma and its pathwise vega is exact. Memory is O(nSteps) either way. With Sext == S0 the objective is
+ * `price_lookback_MC(params, seed)` for the same nPaths and nSteps.
+ *
+ * @param quotes Quotes to invert.
+ * @param nPaths Number of Monte Carlo paths.
+ * @param nSteps Number of time steps per path.
+ * @param seed RNG seed.
+ * @param cube Optional pre-generated normals matching seed and shape.
+ * @param settings Solver controls.
+ * @return One result per quote.
+ * @throw std::invalid_argument if `cube` does not match the run.
+ */
+std::vector<ImpliedVolResult> implied_vol_MC(const std::vector<LookbackQuote>& quotes,
+                                             int nPaths,
+                                             int nSteps,
+                                             unsigned long seed,
+                                             const NormalCube* cube = nullptr,
+                                             const ImpliedVolSettings& settings = {});
+
+#endif // IMPLIEDVOLATILITY_H
@@ -0,0 +1,162 @@
+/**
+ * @file LookbackCApi.h
+ * @brief Stable C ABI of the lookback pricer, for use as a shared library.
+ *
+ * Every function works on caller-owned structure-of-arrays buffers of `n`
+ * trades and writes into caller-owned output arrays; nothing is allocated
+ * or retained across calls. The functions hold no global state, so they
+ * are reentrant and may be called concurrently from any thread.
+ *
+ * Option types use 1 = Call, 2 = Put, as in excel_inputs.txt. Optional
+ * output pointers may be NULL.
+ */
+
+#ifndef LOOKBACKCAPI_H
+#define LOOKBACKCAPI_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#  if defined(LOOKBACK_BUILD_DLL)
+#    define LOOKBACK_API __declspec(dllexport)
+#  else
+#    define LOOKBACK_API __declspec(dllimport)
+#  endif
+#else
+#  define LOOKBACK_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Version of this ABI; bumped on any incompatible change. */
+#define LB_ABI_VERSION 1
+
+/** Status codes returned by every function. */
+enum {
+    LB_OK = 0,              /**< Success */
+    LB_INVALID_ARGUMENT = 1,/**< NULL required pointer or out-of-range value */
+    LB_INTERNAL_ERROR = 2   /**< Unexpected failure inside the engine */
+};
+
+/**
+ * @brief ABI version the library was built with (compare to LB_ABI_VERSION).
+ */
+LOOKBACK_API int32_t lb_abi_version(void);
+
+/**
+ * @brief Human-readable description of a status code.
+ */
+LOOKBACK_API const char* lb_status_string(int32_t status);
+
+/**
+ * @brief Monte Carlo prices (`price_lookback_MC`) of `n` trades.
+ *
+ * @param n Number of trades.
+ * @param S0 Spot prices [n].
+ * @param r Risk-free rates [n].
+ * @param sigma Volatilities [n].
+ * @param T Maturities [n].
+ * @param type Option types [n] (1 = Call, 2 = Put).
+ * @param nPaths Number of paths per trade (>= 1).
+ * @param nSteps Number of time steps per path (>= 1).
+ * @param seed RNG seed shared by all trades; must fit in `unsigned long`
+ *             (32 bits on Windows), otherwise LB_INVALID_ARGUMENT.
+ * @param nThreads Worker threads over trades (<= 1 runs on the caller's thread).
+ * @param price Output prices [n].
+ * @param stdError Optional output standard errors [n].
+ * @return Status code.
+ */
+LOOKBACK_API int32_t lb_price_mc(size_t n,
+                                 const double* S0,
+                                 const double* r,
+                                 const double* sigma,
+                                 const double* T,
+                                 const int32_t* type,
+                                 int32_t nPaths,
+                                 int32_t nSteps,
+                                 uint64_t seed,
+                                 int32_t nThreads,
+                                 double* price,
+                                 double* stdError);
+
+/**
+ * @brief Monte Carlo price and Greeks (`compute_greeks_MC`) of `n` trades.
+ *
+ * @param n Number of trades.
+ * @param S0 Spot prices [n].
+ * @param r Risk-free rates [n].
+ * @param sigma Volatilities [n].
+ * @param T Maturities [n].
+ * @param type Option types [n] (1 = Call, 2 = Put).
+ * @param nPaths Number of paths per trade (>= 1).
+ * @param nSteps Number of time steps per path (>= 1).
+ * @param bumpS Bump in S (Gamma).
+ * @param bumpSigma Bump in sigma.
+ * @param bumpR Bump in r (Rho).
+ * @param bumpT Bump in T (Theta).
+ * @param seed RNG seed shared by all trades; must fit in `unsigned long`
+ *             (32 bits on Windows), otherwise LB_INVALID_ARGUMENT.
+ * @param nThreads Worker threads over trades (<= 1 runs on the caller's thread).
+ * @param price Output prices [n].
+ * @param stdError Optional output standard errors [n].
+ * @param delta Optional output deltas [n].
+ * @param gamma Optional output gammas [n].
+ * @param theta Optional output thetas [n].
+ * @param rho Optional output rhos [n].
+ * @param vega Optional output vegas [n].
+ * @return Status code.
+ */
+LOOKBACK_API int32_t lb_greeks_mc(size_t n,
+                                  const double* S0,
+                                  const double* r,
+                                  const double* sigma,
+                                  const double* T,
+                                  const int32_t* type,
+                                  int32_t nPaths,
+                                  int32_t nSteps,
+                                  double bumpS,
+                                  double bumpSigma,
+                                  double bumpR,
+                                  double bumpT,
+                                  uint64_t seed,
+                                  int32_t nThreads,
+                                  double* price,
+                                  double* stdError,
+                                  double* delta,
+                                  double* gamma,
+                                  double* theta,
+                                  double* rho,
+                                  double* vega);
+
+/**
+ * @brief Exact prices and vegas (`lookback_call_exact`/`lookback_put_exact`).
+ *
+ * @param n Number of trades.
+ * @param S0 Spot prices [n].
+ * @param Sext Running minimum (call) or maximum (put) so far [n].
+ * @param r Risk-free rates [n] (non-zero).
+ * @param sigma Volatilities [n].
+ * @param T Maturities [n].
+ * @param type Option types [n] (1 = Call, 2 = Put).
+ * @param price Output prices [n].
+ * @param vega Optional output vegas [n].
+ * @return Status code.
+ */
+LOOKBACK_API int32_t lb_exact(size_t n,
+                              const double* S0,
+                              const double* Sext,
+                              const double* r,
+                              const double* sigma,
+                              const double* T,
+                              const int32_t* type,
+                              double* price,
+                              double* vega);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LOOKBACKCAPI_H
@@ -7,9 +7,16 @@
 #ifndef LOOKBACK_OPTION_H
 #define LOOKBACK_OPTION_H
 
+#include <memory>
 #include <vector>
 #include <string>
 
+class NormalCube;
+class PathModel;
+
+/// Number of paths simulated per engine call.
+constexpr int kPathBlock = 4096;
+
 /**
  * @brief Type of lookback option.
  */
@@ -18,6 +25,27 @@ enum class LookbackType {
     Put
 };
 
+/**
+ * @brief Dynamics used to simulate the underlying.
+ */
+enum class ModelType {
+    BlackScholes,   ///< Constant-volatility geometric Brownian motion
+    Heston          ///< Heston stochastic volatility (Andersen QE scheme)
+};
+
+/**
+ * @brief Heston variance-process parameters.
+ *
+ * The initial variance is taken from `MCParams::sigma` as v0 = sigma^2, so
+ * `sigma` keeps its meaning of "current volatility" for both models.
+ */
+struct HestonParams {
+    double kappa = 0.0;   ///< Mean-reversion speed of the variance
+    double theta = 0.0;   ///< Long-run variance
+    double xi    = 0.0;   ///< Volatility of variance
+    double rho   = 0.0;   ///< Spot/variance correlation
+};
+
 /**
  * @brief Parameters for Monte Carlo pricing.
  */
@@ -29,6 +57,9 @@ struct MCParams {
     LookbackType type;
     int nPaths;
     int nSteps;
+    ModelType model = ModelType::BlackScholes;   ///< Path dynamics
+    HestonParams heston{};                        ///< Used when model == Heston
+    const NormalCube* cube = nullptr;             ///< Pre-generated normals (Black-Scholes only)
 };
 
 /**
@@ -42,6 +73,64 @@ struct MCParams {
  */
 double payoff_lookback(double ST, double minS, double maxS, LookbackType type);
 
+/**
+ * @brief Monte Carlo price estimate with its statistical error.
+ */
+struct MCEstimate {
+    double price;      ///< Discounted mean payoff
+    double stdError;   ///< Standard error of `price`
+    int nPaths;        ///< Number of paths behind the estimate
+};
+
+/**
+ * @brief Incremental Monte Carlo pricer of a floating-strike lookback option.
+ *
+ * Paths are added with `advance`; `estimate` can be read at any point.
+ * The engine always simulates the same `kPathBlock` blocks and partial
+ * advances are served from the buffered block, so advancing in several
+ * calls gives exactly the same final estimate as `price_lookback_MC`, for
+ * every model, and intermediate results can be published for free.
+ */
+class LookbackPricer {
+public:
+    /**
+     * @brief Prepare a run of up to `params.nPaths` paths.
+     *
+     * @param params Monte Carlo parameters (see `MCParams`).
+     * @param seed RNG seed for reproducibility.
+     */
+    LookbackPricer(const MCParams& params, unsigned long seed);
+    ~LookbackPricer();
+
+    LookbackPricer(LookbackPricer&&) noexcept;
+    LookbackPricer& operator=(LookbackPricer&&) noexcept;
+
+    /**
+     * @brief Simulate `n` more paths (capped at `params.nPaths` in total).
+     */
+    void advance(int n);
+
+    /**
+     * @brief Number of paths accumulated so far.
+     */
+    int paths() const { return done; }
+
+    /**
+     * @brief Current price estimate and standard error.
+     */
+    MCEstimate estimate() const;
+
+private:
+    MCParams params;                    // run parameters
+    std::unique_ptr<PathModel> model;   // path engine
+    std::vector<double> ST, Smin, Smax; // block buffers
+    double sumPayoff = 0.0;             // sum of payoffs
+    double sumPayoffSq = 0.0;           // sum of squared payoffs
+    int done = 0;                       // paths accumulated so far
+    int simulated = 0;                  // paths drawn from the engine so far
+    int blockLen = 0;                   // paths in the buffered block
+};
+
 /**
  * @brief Monte Carlo pricing of a floating-strike lookback option.
  *
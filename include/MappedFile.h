@@ -0,0 +1,46 @@
+/**
+ * @file MappedFile.h
+ * @brief Read-only memory mapping of a file, shared between processes.
+ */
+
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+
+class MappedFile {
+public:
+    /**
+     * @brief Map a whole file read-only.
+     *
+     * @param path File to map.
+     * @throw std::runtime_error if the file cannot be opened or mapped.
+     */
+    explicit MappedFile(const std::string& path);
+
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief First byte of the mapping (nullptr for an empty file).
+     */
+    const unsigned char* data() const { return bytes; }
+
+    /**
+     * @brief Size of the mapping in bytes.
+     */
+    std::size_t size() const { return length; }
+
+private:
+    const unsigned char* bytes = nullptr;   // mapped view
+    std::size_t length = 0;                 // mapped size
+#ifdef _WIN32
+    void* fileHandle = nullptr;             // HANDLE of the file
+    void* mapHandle = nullptr;              // HANDLE of the mapping object
+#endif
+};
+
+#endif // MAPPEDFILE_H
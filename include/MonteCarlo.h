@@ -9,8 +9,9 @@
 
 #include <vector>
 #include <random>
+#include "PathModel.h"
 
-class MonteCarlo {
+class MonteCarlo : public PathModel {
 public:
     /**
      * @brief Construct a Monte Carlo engine.
@@ -35,6 +36,22 @@ public:
      */
     std::vector<double> generate_path();
 
+    /**
+     * @brief Read normal increments from memory instead of the RNG.
+     *
+     * @param Z First normal of the first path; consecutive paths follow
+     *          contiguously (e.g. `NormalCube::data()`).
+     */
+    void use_normals(const double* Z);
+
+    /**
+     * @brief Simulate a block of paths, keeping only terminal and extreme spots.
+     */
+    void simulate_block(int nPaths,
+                        double* ST,
+                        double* Smin,
+                        double* Smax) override;
+
 private:
     // Model parameters
     double S0;      // initial asset price
@@ -46,6 +63,7 @@ private:
     // Random number generation
     std::mt19937 rng;                          // Mersenne Twister RNG
     std::normal_distribution<double> normal;   // standard normal distribution
+    const double* presetZ = nullptr;           // pre-generated normals, if any
 };
 
 #endif // MONTECARLO_H
@@ -0,0 +1,99 @@
+/**
+ * @file NormalCube.h
+ * @brief On-disk cube of pre-generated standard normal increments, memory
+ *        mapped read-only and reused across pricing runs and processes.
+ */
+
+#ifndef NORMALCUBE_H
+#define NORMALCUBE_H
+
+#include <cstdint>
+#include <string>
+#include "MappedFile.h"
+
+/**
+ * @brief Generator whose normal stream a cube reproduces.
+ *
+ * Only the Black-Scholes `MonteCarlo` engine reads cubes, so it is the only
+ * generator; the pathwise Greeks run and the Heston engine always draw
+ * their own streams.
+ */
+enum class CubeRng : std::uint32_t {
+    MT19937 = 1   ///< std::mt19937 + std::normal_distribution (MonteCarlo engine)
+};
+
+/**
+ * @brief Read-only view of a normal cube file.
+ *
+ * The file holds a 64-byte header followed by nPaths * nSteps doubles,
+ * path-major, in exactly the order the generator draws them. Pricing from
+ * the cube therefore reproduces pricing from the seed bit for bit.
+ */
+class NormalCube {
+public:
+    /**
+     * @brief Generate a cube file.
+     *
+     * The file is written to a uniquely named temp file next to `path` and
+     * renamed into place, so processes mapping an older cube are never
+     * exposed to a partial file and concurrent generators do not collide.
+     * If the rename fails because another writer's matching cube is in
+     * place (and held open), that cube is accepted.
+     *
+     * @param path Output file.
+     * @param seed RNG seed.
+     * @param nPaths Number of paths.
+     * @param nSteps Number of time steps per path.
+     * @param rng Generator to reproduce.
+     * @throw std::runtime_error on I/O failure.
+     */
+    static void generate(const std::string& path,
+                         unsigned long seed,
+                         int nPaths,
+                         int nSteps,
+                         CubeRng rng = CubeRng::MT19937);
+
+    /**
+     * @brief Map an existing cube file.
+     *
+     * @param path Cube file.
+     * @throw std::runtime_error if the file is missing or not a valid cube.
+     */
+    explicit NormalCube(const std::string& path);
+
+    /**
+     * @brief Check whether the cube can serve a run.
+     *
+     * @param seed RNG seed of the run.
+     * @param nPaths Number of paths of the run (at most the cube's).
+     * @param nSteps Number of time steps per path (must be equal).
+     * @param rng Generator of the run.
+     * @return True if the first nPaths cube paths are the run's normals.
+     */
+    bool matches(unsigned long seed, int nPaths, int nSteps, CubeRng rng) const;
+
+    /**
+     * @brief Normals of path `i` (nSteps consecutive values).
+     */
+    const double* path(int i) const { return normals + static_cast<std::size_t>(i) * nSteps; }
+
+    /**
+     * @brief All normals, path-major.
+     */
+    const double* data() const { return normals; }
+
+    unsigned long seed() const { return cubeSeed; }
+    int paths() const { return nPaths; }
+    int steps() const { return nSteps; }
+    CubeRng rng() const { return cubeRng; }
+
+private:
+    MappedFile file;                 // read-only mapping
+    const double* normals = nullptr; // first normal after the header
+    unsigned long cubeSeed = 0;      // seed the cube was generated from
+    int nPaths = 0;                  // number of paths
+    int nSteps = 0;                  // number of time steps per path
+    CubeRng cubeRng = CubeRng::MT19937;
+};
+
+#endif // NORMALCUBE_H
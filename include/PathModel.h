@@ -0,0 +1,51 @@
+/**
+ * @file PathModel.h
+ * @brief Common interface of the path engines used by the lookback pricer.
+ */
+
+#ifndef PATHMODEL_H
+#define PATHMODEL_H
+
+#include <memory>
+#include "LookbackOption.h"
+
+/**
+ * @brief Path engine producing the statistics a lookback payoff needs.
+ *
+ * Engines keep their RNG state between calls, so a run is reproducible from
+ * its seed and the sequence of block sizes it is simulated in. The paths of
+ * the Heston engine, which steps a whole block at once, depend on that
+ * sequence; `LookbackPricer` therefore always simulates a run in the same
+ * `kPathBlock` blocks.
+ */
+class PathModel {
+public:
+    virtual ~PathModel() = default;
+
+    /**
+     * @brief Simulate a block of paths.
+     *
+     * @param nPaths Number of paths in the block.
+     * @param ST Output terminal spot of each path (size >= nPaths).
+     * @param Smin Output minimum spot of each path (size >= nPaths).
+     * @param Smax Output maximum spot of each path (size >= nPaths).
+     */
+    virtual void simulate_block(int nPaths,
+                                double* ST,
+                                double* Smin,
+                                double* Smax) = 0;
+};
+
+/**
+ * @brief Build the path engine selected by `params.model`.
+ *
+ * @param params Monte Carlo parameters.
+ * @param seed RNG seed.
+ * @return Engine ready to simulate paths.
+ * @throw std::invalid_argument if `params.cube` cannot serve this run, or
+ *        if the Heston parameters are out of range.
+ */
+std::unique_ptr<PathModel> make_path_model(const MCParams& params,
+                                           unsigned long seed);
+
+#endif // PATHMODEL_H
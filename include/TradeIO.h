@@ -0,0 +1,146 @@
+/**
+ * @file TradeIO.h
+ * @brief Chunked reading of trade files and streaming writing of results,
+ *        in CSV or in a fixed-width binary columnar format.
+ *
+ * CSV trades: `id,S0,r,sigma,T,type,nPaths,nSteps` (type 1/C/Call = Call,
+ * 2/P/Put = Put, case-insensitive; a header line is optional).
+ * CSV results: `id,price,stdError,delta,gamma,theta,rho,vega`.
+ *
+ * Binary files start with a 64-byte header (magic "LBCOLS01", header size,
+ * file kind, row count, rows per group) followed by row groups. Each group
+ * stores its columns one after another, each column padded to 8 bytes, so
+ * every group is at a fixed offset and can be read straight from a mapping.
+ * Trade columns: id u64, S0 f64, r f64, sigma f64, T f64, nPaths i32,
+ * nSteps i32, type u8. Result columns: id u64, then the seven CSV values
+ * as f64.
+ */
+
+#ifndef TRADEIO_H
+#define TRADEIO_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "LookbackOption.h"
+#include "Greeks.h"
+
+/**
+ * @brief On-disk representation of trade and result files.
+ */
+enum class FileFormat {
+    CSV,      ///< Comma-separated text
+    Binary    ///< Fixed-width binary columnar
+};
+
+/**
+ * @brief One trade of a batch.
+ */
+struct Trade {
+    std::uint64_t id;   ///< Trade identifier
+    MCParams params;    ///< Pricing parameters
+};
+
+/**
+ * @brief Pricing result of one trade.
+ */
+struct TradeResult {
+    std::uint64_t id;   ///< Trade identifier
+    Greeks greeks;      ///< Price, standard error and Greeks
+};
+
+/**
+ * @brief Sequential reader of a trade file, chunk by chunk.
+ */
+class TradeReader {
+public:
+    virtual ~TradeReader() = default;
+
+    /**
+     * @brief Read the next trades.
+     *
+     * @param out Receives the trades (cleared first).
+     * @param maxRows Maximum number of trades to read.
+     * @return Number of trades read, 0 at end of file.
+     * @throw std::runtime_error on malformed input or an unpriceable trade
+     *        (unknown type, non-positive nPaths/nSteps), naming the line or row.
+     */
+    virtual std::size_t read(std::vector<Trade>& out, std::size_t maxRows) = 0;
+};
+
+/**
+ * @brief Streaming writer of trades.
+ */
+class TradeWriter {
+public:
+    virtual ~TradeWriter() = default;
+
+    /**
+     * @brief Append trades to the file.
+     */
+    virtual void write(const std::vector<Trade>& trades) = 0;
+
+    /**
+     * @brief Flush and finalize the file.
+     */
+    virtual void close() = 0;
+};
+
+/**
+ * @brief Streaming writer of pricing results.
+ */
+class ResultWriter {
+public:
+    virtual ~ResultWriter() = default;
+
+    /**
+     * @brief Append results to the file.
+     */
+    virtual void write(const std::vector<TradeResult>& results) = 0;
+
+    /**
+     * @brief Flush and finalize the file.
+     */
+    virtual void close() = 0;
+};
+
+/**
+ * @brief Format implied by a file name (".csv" = CSV, anything else = Binary).
+ */
+FileFormat format_from_path(const std::string& path);
+
+/**
+ * @brief Memory-map a trade file; the format is detected from its content.
+ *
+ * @param path Trade file.
+ * @return Reader positioned at the first trade.
+ * @throw std::runtime_error if the file cannot be opened.
+ */
+std::unique_ptr<TradeReader> open_trade_reader(const std::string& path);
+
+/**
+ * @brief Create a trade file.
+ *
+ * @param path Output file.
+ * @param format Output format.
+ * @param groupRows Rows per binary row group (rounded up to a multiple of 8).
+ * @throw std::runtime_error if the file cannot be created.
+ */
+std::unique_ptr<TradeWriter> open_trade_writer(const std::string& path,
+                                               FileFormat format,
+                                               int groupRows = 4096);
+
+/**
+ * @brief Create a result file.
+ *
+ * @param path Output file.
+ * @param format Output format.
+ * @param groupRows Rows per binary row group (rounded up to a multiple of 8).
+ * @throw std::runtime_error if the file cannot be created.
+ */
+std::unique_ptr<ResultWriter> open_result_writer(const std::string& path,
+                                                 FileFormat format,
+                                                 int groupRows = 4096);
+
+#endif // TRADEIO_H
@@ -0,0 +1,193 @@
+"""
+Python bindings for the lookback option pricer shared library.
+
+Thin ctypes wrapper over the C ABI declared in include/LookbackCApi.h.
+NumPy arrays that are already contiguous with the expected dtype
+(float64, int32 for option types) are passed to the library by pointer,
+without copying; outputs are allocated once here, or passed in through
+`out=`, and filled in place by the library. ctypes releases the GIL for
+the duration of every call, so simulations run concurrently with other
+Python threads.
+
+The library is looked up in $LOOKBACK_LIBRARY, then next to this file.
+"""
+
+import ctypes
+import operator
+import os
+import sys
+
+import numpy as np
+
+__all__ = ["CALL", "PUT", "LookbackError", "price_mc", "greeks_mc", "exact"]
+
+CALL = 1
+PUT = 2
+
+_ABI_VERSION = 1
+
+_INT32_MAX = 2 ** 31 - 1
+_ULONG_MAX = 2 ** (8 * ctypes.sizeof(ctypes.c_ulong)) - 1   # the pricers' seed type
+
+_f64_p = ctypes.POINTER(ctypes.c_double)
+_i32_p = ctypes.POINTER(ctypes.c_int32)
+
+
+class LookbackError(RuntimeError):
+    """Raised when the library returns a non-zero status."""
+
+
+def _load():
+    path = os.environ.get("LOOKBACK_LIBRARY")
+    if not path:
+        name = {"win32": "lookback.dll", "darwin": "liblookback.dylib"}.get(sys.platform, "liblookback.so")
+        path = os.path.join(os.path.dirname(os.path.abspath(__file__)), name)
+
+    lib = ctypes.CDLL(path)
+
+    lib.lb_abi_version.restype = ctypes.c_int32
+    lib.lb_abi_version.argtypes = []
+    lib.lb_status_string.restype = ctypes.c_char_p
+    lib.lb_status_string.argtypes = [ctypes.c_int32]
+
+    lib.lb_price_mc.restype = ctypes.c_int32
+    lib.lb_price_mc.argtypes = ([ctypes.c_size_t] + [_f64_p] * 4 + [_i32_p]
+                                + [ctypes.c_int32] * 2 + [ctypes.c_uint64, ctypes.c_int32]
+                                + [_f64_p] * 2)
+
+    lib.lb_greeks_mc.restype = ctypes.c_int32
+    lib.lb_greeks_mc.argtypes = ([ctypes.c_size_t] + [_f64_p] * 4 + [_i32_p]
+                                 + [ctypes.c_int32] * 2 + [ctypes.c_double] * 4
+                                 + [ctypes.c_uint64, ctypes.c_int32] + [_f64_p] * 7)
+
+    lib.lb_exact.restype = ctypes.c_int32
+    lib.lb_exact.argtypes = [ctypes.c_size_t] + [_f64_p] * 5 + [_i32_p] + [_f64_p] * 2
+
+    if lib.lb_abi_version() != _ABI_VERSION:
+        raise LookbackError("library ABI version %d, bindings expect %d"
+                            % (lib.lb_abi_version(), _ABI_VERSION))
+    return lib
+
+
+_lib = _load()
+
+
+def _inputs(dtypes, *arrays):
+    """Broadcast inputs to one length; contiguous arrays of the right dtype are not copied."""
+    shaped = np.broadcast_arrays(*[np.asarray(a) for a in arrays])
+    n = shaped[0].size
+    out = []
+    for a, dt in zip(shaped, dtypes):
+        a = np.ascontiguousarray(a.reshape(n) if a.ndim != 1 else a, dtype=dt)
+        out.append(a)
+    return n, out
+
+
+def _int_arg(value, name, lo, hi):
+    """Check an integer argument before ctypes silently wraps or truncates it."""
+    value = operator.index(value)
+    if not lo <= value <= hi:
+        raise ValueError("%s must be in [%d, %d], got %d" % (name, lo, hi, value))
+    return value
+
+
+def _mc_args(n_paths, n_steps, seed):
+    """Range-checked (n_paths, n_steps, seed) of a Monte Carlo call."""
+    return (_int_arg(n_paths, "n_paths", 1, _INT32_MAX),
+            _int_arg(n_steps, "n_steps", 1, _INT32_MAX),
+            _int_arg(seed, "seed", 0, _ULONG_MAX))
+
+
+def _output(a, n, name):
+    """Allocate an output of length n, or check a caller-supplied one can be written in place."""
+    if a is None:
+        return np.empty(n)
+    if not isinstance(a, np.ndarray) or a.dtype != np.float64 or a.ndim != 1 or a.size != n \
+            or not a.flags.c_contiguous or not a.flags.writeable:
+        raise ValueError("out %s must be a writeable C-contiguous float64 array of length %d"
+                         % (name, n))
+    return a
+
+
+def _ptr(a, ctype):
+    return a.ctypes.data_as(ctype) if a is not None else None
+
+
+def _check(status):
+    if status != 0:
+        raise LookbackError(_lib.lb_status_string(status).decode())
+
+
+def price_mc(S0, r, sigma, T, type, n_paths, n_steps, seed=12345, threads=0, out=None):
+    """
+    Monte Carlo prices of a batch of lookback options.
+
+    Array arguments broadcast against each other. `threads` <= 1 prices on
+    the calling thread (still without the GIL); 0 uses all CPUs. `n_paths`
+    and `n_steps` must be in [1, 2**31 - 1] and `seed` must fit in a C
+    unsigned long (32 bits on Windows); ValueError is raised otherwise.
+
+    `out` is an optional (price, std_error) pair of preallocated arrays
+    (either may be None) that are filled in place.
+
+    Returns (price, std_error) as float64 arrays.
+    """
+    n_paths, n_steps, seed = _mc_args(n_paths, n_steps, seed)
+    n, (S0, r, sigma, T, type) = _inputs([np.float64] * 4 + [np.int32], S0, r, sigma, T, type)
+    out = (None, None) if out is None else out
+    price, std_error = _output(out[0], n, "price"), _output(out[1], n, "std_error")
+
+    _check(_lib.lb_price_mc(n, _ptr(S0, _f64_p), _ptr(r, _f64_p), _ptr(sigma, _f64_p),
+                            _ptr(T, _f64_p), _ptr(type, _i32_p), n_paths, n_steps, seed,
+                            threads or os.cpu_count() or 1,
+                            _ptr(price, _f64_p), _ptr(std_error, _f64_p)))
+    return price, std_error
+
+
+def greeks_mc(S0, r, sigma, T, type, n_paths, n_steps, seed=12345, threads=0,
+              bump_S=1.0, bump_sigma=0.0001, bump_r=0.01, bump_T=1.0 / 365.0, out=None):
+    """
+    Monte Carlo price and Greeks of a batch of lookback options.
+
+    Arguments are checked as in `price_mc`. `out` is an optional dict of
+    preallocated arrays keyed like the result; missing keys are allocated.
+
+    Returns a dict of float64 arrays: price, std_error, delta, gamma,
+    theta, rho, vega.
+    """
+    n_paths, n_steps, seed = _mc_args(n_paths, n_steps, seed)
+    n, (S0, r, sigma, T, type) = _inputs([np.float64] * 4 + [np.int32], S0, r, sigma, T, type)
+    keys = ("price", "std_error", "delta", "gamma", "theta", "rho", "vega")
+    given = {} if out is None else out
+    unknown = set(given) - set(keys)
+    if unknown:
+        raise ValueError("unknown out keys: %s" % ", ".join(sorted(unknown)))
+    out = {k: _output(given.get(k), n, k) for k in keys}
+
+    _check(_lib.lb_greeks_mc(n, _ptr(S0, _f64_p), _ptr(r, _f64_p), _ptr(sigma, _f64_p),
+                             _ptr(T, _f64_p), _ptr(type, _i32_p), n_paths, n_steps,
+                             bump_S, bump_sigma, bump_r, bump_T, seed,
+                             threads or os.cpu_count() or 1,
+                             *[_ptr(out[k], _f64_p) for k in keys]))
+    return out
+
+
+def exact(S0, Sext, r, sigma, T, type, out=None):
+    """
+    Closed-form prices and vegas of a batch of lookback options.
+
+    `Sext` is the running minimum (call) or maximum (put) observed so far.
+    `out` is an optional (price, vega) pair of preallocated arrays (either
+    may be None) that are filled in place.
+
+    Returns (price, vega) as float64 arrays.
+    """
+    n, (S0, Sext, r, sigma, T, type) = _inputs([np.float64] * 5 + [np.int32],
+                                               S0, Sext, r, sigma, T, type)
+    out = (None, None) if out is None else out
+    price, vega = _output(out[0], n, "price"), _output(out[1], n, "vega")
+
+    _check(_lib.lb_exact(n, _ptr(S0, _f64_p), _ptr(Sext, _f64_p), _ptr(r, _f64_p),
+                         _ptr(sigma, _f64_p), _ptr(T, _f64_p), _ptr(type, _i32_p),
+                         _ptr(price, _f64_p), _ptr(vega, _f64_p)))
+    return price, vega
@@ -0,0 +1,196 @@
+#include "BatchPricer.h"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Unit of work flowing through the pipeline.
+ */
+struct Chunk {
+    std::size_t index = 0;              ///< Position in the input
+    std::vector<Trade> trades;          ///< Parsed trades
+    std::vector<TradeResult> results;   ///< Filled by a worker
+};
+
+/**
+ * @brief State shared by the pipeline stages, guarded by `m`.
+ */
+struct Pipeline {
+    std::mutex m;
+    std::condition_variable cv;
+
+    std::deque<std::unique_ptr<Chunk>> todo;                // parsed, not priced
+    std::map<std::size_t, std::unique_ptr<Chunk>> done;     // priced, not written
+    std::size_t inFlight = 0;                               // chunks alive
+
+    bool readDone = false;        // reader hit end of input
+    std::size_t nChunks = 0;      // total chunks, valid once readDone
+    bool abort = false;           // a stage failed
+    std::exception_ptr error;     // first failure
+
+    /**
+     * @brief Record the current exception and stop every stage.
+     */
+    void fail()
+    {
+        std::lock_guard<std::mutex> lk(m);
+        if (!error) error = std::current_exception();
+        abort = true;
+        cv.notify_all();
+    }
+};
+
+} // namespace
+
+/**
+ * @brief Price every trade of a file and stream the results to another.
+ *
+ * @param inputPath Trade file (CSV or binary, detected from content).
+ * @param outputPath Result file.
+ * @param outputFormat Result file format.
+ * @param settings Pipeline controls.
+ * @return Number of trades priced.
+ */
+std::uint64_t price_trade_file(const std::string& inputPath,
+                               const std::string& outputPath,
+                               const FileFormat outputFormat,
+                               const BatchSettings& settings)
+{
+    std::unique_ptr<TradeReader> reader = open_trade_reader(inputPath);
+    std::unique_ptr<ResultWriter> writer = open_result_writer(outputPath, outputFormat);
+
+    const int nWorkers = settings.workers > 0
+        ? settings.workers
+        : std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    const std::size_t chunkRows = static_cast<std::size_t>(std::max(1, settings.chunkRows));
+    const std::size_t maxInFlight = static_cast<std::size_t>(
+        settings.maxChunksInFlight > 0 ? settings.maxChunksInFlight : 2 * nWorkers + 2);
+
+    Pipeline pl;
+
+    // -------------------------------------------------------------------------
+    // Reader: parse chunks while a slot is free
+    // -------------------------------------------------------------------------
+    std::thread readerThread([&] {
+        try {
+            for (std::size_t idx = 0; ; ++idx)
+            {
+                {
+                    std::unique_lock<std::mutex> lk(pl.m);
+                    pl.cv.wait(lk, [&] { return pl.inFlight < maxInFlight || pl.abort; });
+                    if (pl.abort) return;
+                    ++pl.inFlight;
+                }
+
+                auto chunk = std::make_unique<Chunk>();
+                chunk->index = idx;
+
+                const bool eof = reader->read(chunk->trades, chunkRows) == 0;
+
+                std::lock_guard<std::mutex> lk(pl.m);
+                if (eof) {
+                    --pl.inFlight;
+                    pl.readDone = true;
+                    pl.nChunks = idx;
+                } else {
+                    pl.todo.push_back(std::move(chunk));
+                }
+                pl.cv.notify_all();
+
+                if (eof) return;
+            }
+        } catch (...) {
+            pl.fail();
+        }
+    });
+
+    // -------------------------------------------------------------------------
+    // Workers: price whole chunks
+    // -------------------------------------------------------------------------
+    std::vector<std::thread> workers;
+    for (int w = 0; w < nWorkers; ++w)
+    {
+        workers.emplace_back([&] {
+            for (;;)
+            {
+                std::unique_ptr<Chunk> chunk;
+                {
+                    std::unique_lock<std::mutex> lk(pl.m);
+                    pl.cv.wait(lk, [&] { return !pl.todo.empty() || pl.readDone || pl.abort; });
+                    if (pl.abort || pl.todo.empty()) return;
+                    chunk = std::move(pl.todo.front());
+                    pl.todo.pop_front();
+                }
+
+                try {
+                    chunk->results.reserve(chunk->trades.size());
+                    for (const Trade& t : chunk->trades)
+                        chunk->results.push_back(TradeResult{
+                            t.id,
+                            compute_greeks_MC(t.params,
+                                              settings.bumpS,
+                                              settings.bumpSigma,
+                                              settings.bumpR,
+                                              settings.bumpT,
+                                              settings.seed)});
+                } catch (...) {
+                    pl.fail();
+                    return;
+                }
+
+                std::lock_guard<std::mutex> lk(pl.m);
+                pl.done.emplace(chunk->index, std::move(chunk));
+                pl.cv.notify_all();
+            }
+        });
+    }
+
+    // -------------------------------------------------------------------------
+    // Writer (this thread): stream chunks in input order
+    // -------------------------------------------------------------------------
+    std::uint64_t nTrades = 0;
+
+    try {
+        for (std::size_t next = 0; ; ++next)
+        {
+            std::unique_ptr<Chunk> chunk;
+            {
+                std::unique_lock<std::mutex> lk(pl.m);
+                pl.cv.wait(lk, [&] {
+                    return pl.abort || pl.done.count(next) != 0
+                        || (pl.readDone && next == pl.nChunks);
+                });
+                if (pl.abort || pl.done.count(next) == 0) break;
+
+                chunk = std::move(pl.done[next]);
+                pl.done.erase(next);
+            }
+
+            writer->write(chunk->results);
+            nTrades += chunk->results.size();
+
+            std::lock_guard<std::mutex> lk(pl.m);
+            --pl.inFlight;
+            pl.cv.notify_all();
+        }
+    } catch (...) {
+        pl.fail();
+    }
+
+    readerThread.join();
+    for (std::thread& t : workers) t.join();
+
+    if (pl.error)
+        std::rethrow_exception(pl.error);
+
+    writer->close();
+    return nTrades;
+}
@@ -10,6 +10,15 @@ double norm_cdf(double x) {
     return 0.5 * std::erfc(-x / std::sqrt(2.0));
 }
 
+/**
+ * @brief Standard normal probability density function.
+ * @param x Input value.
+ * @return PDF of standard normal at `x`.
+ */
+static double norm_pdf(double x) {
+    return 0.3989422804014327 * std::exp(-0.5 * x * x);
+}
+
 /**
  * @brief Exact price of a floating-strike lookback Call (Goldman, 1979).
  *
@@ -77,7 +86,7 @@ double lookback_put_exact(const double S0,
     const double b3 = (logMS + (r - 0.5 * sig2) * T) / (sigma * sqrtT);
 
     // Drift adjustment term from the reflection principle
-    const double Y2 = 2.0 * (r - 0.5 * sig2) * std::log(S0 / Smax) / sig2;
+    const double Y2 = 2.0 * (r - 0.5 * sig2) * logMS / sig2;
 
     // Discount factor and volatility coefficient
     const double discount = std::exp(-r * T);
@@ -88,4 +97,100 @@ double lookback_put_exact(const double S0,
     const double part2 = S0 * ( coeff * norm_cdf(-b2) - norm_cdf(b2) );
 
     return part1 + part2;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Analytic vega of the floating-strike lookback Call.
+ *
+ * Term-by-term derivative of `lookback_call_exact` with respect to sigma.
+ *
+ * @param S0 Current spot price.
+ * @param Smin Minimum observed spot.
+ * @param r Risk-free rate.
+ * @param sigma Volatility.
+ * @param T Time to maturity.
+ * @return Exact call vega.
+ */
+double lookback_call_exact_vega(const double S0,
+                                const double Smin,
+                                const double r,
+                                const double sigma,
+                                const double T)
+{
+    // Same auxiliary quantities as the price
+    const double sqrtT = std::sqrt(T);
+    const double sig2  = sigma * sigma;
+    const double logSM = std::log(S0 / Smin);
+
+    const double a1 = (logSM + (r + 0.5 * sig2) * T) / (sigma * sqrtT);
+    const double a2 = a1 - sigma * sqrtT;
+    const double a3 = (logSM + (-r + 0.5 * sig2) * T) / (sigma * sqrtT);
+    const double Y1 = -2.0 * (r - 0.5 * sig2) * logSM / sig2;
+
+    const double discount = std::exp(-r * T);
+    const double coeff    = sig2 / (2.0 * r);
+    const double eY1      = std::exp(Y1);
+
+    // Their derivatives with respect to sigma
+    const double da1    = -(logSM + r * T) / (sig2 * sqrtT) + 0.5 * sqrtT;
+    const double da2    = da1 - sqrtT;
+    const double da3    = -(logSM - r * T) / (sig2 * sqrtT) + 0.5 * sqrtT;
+    const double dY1    = 4.0 * r * logSM / (sig2 * sigma);
+    const double dcoeff = sigma / r;
+
+    const double dPart1 = S0 * ( norm_pdf(a1) * da1 * (1.0 + coeff)
+                               - dcoeff * norm_cdf(-a1) );
+    const double dPart2 = -Smin * discount * ( norm_pdf(a2) * da2
+                               - (dcoeff + coeff * dY1) * eY1 * norm_cdf(-a3)
+                               + coeff * eY1 * norm_pdf(a3) * da3 );
+
+    return dPart1 + dPart2;
+}
+
+/**
+ * @brief Analytic vega of the floating-strike lookback Put.
+ *
+ * Term-by-term derivative of `lookback_put_exact` with respect to sigma.
+ *
+ * @param S0 Current spot price.
+ * @param Smax Maximum observed spot.
+ * @param r Risk-free rate.
+ * @param sigma Volatility.
+ * @param T Time to maturity.
+ * @return Exact put vega.
+ */
+double lookback_put_exact_vega(const double S0,
+                               const double Smax,
+                               const double r,
+                               const double sigma,
+                               const double T)
+{
+    // Same auxiliary quantities as the price
+    const double sqrtT = std::sqrt(T);
+    const double sig2  = sigma * sigma;
+    const double logMS = std::log(Smax / S0);
+
+    const double b1 = (logMS + (-r + 0.5 * sig2) * T) / (sigma * sqrtT);
+    const double b2 = b1 - sigma * sqrtT;
+    const double b3 = (logMS + (r - 0.5 * sig2) * T) / (sigma * sqrtT);
+    const double Y2 = 2.0 * (r - 0.5 * sig2) * logMS / sig2;
+
+    const double discount = std::exp(-r * T);
+    const double coeff    = sig2 / (2.0 * r);
+    const double eY2      = std::exp(Y2);
+
+    // Their derivatives with respect to sigma
+    const double db1    = -(logMS - r * T) / (sig2 * sqrtT) + 0.5 * sqrtT;
+    const double db2    = db1 - sqrtT;
+    const double db3    = -(logMS + r * T) / (sig2 * sqrtT) - 0.5 * sqrtT;
+    const double dY2    = -4.0 * r * logMS / (sig2 * sigma);
+    const double dcoeff = sigma / r;
+
+    const double dPart1 = Smax * discount * ( norm_pdf(b1) * db1
+                               - (dcoeff + coeff * dY2) * eY2 * norm_cdf(-b3)
+                               + coeff * eY2 * norm_pdf(b3) * db3 );
+    const double dPart2 = S0 * ( dcoeff * norm_cdf(-b2)
+                               - norm_pdf(b2) * db2 * (1.0 + coeff) );
+
+    return dPart1 + dPart2;
+}
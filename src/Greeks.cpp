@@ -3,106 +3,267 @@
 // Monte Carlo estimation of floating-strike lookback Greeks (PLAIN MC)
 // - Delta & Vega: Pathwise 
 // - Gamma, Rho, Theta: Finite differences (CRN via same seed)
+// - Heston: Delta by payoff homogeneity in S0, Vega by central FD in the
+//   initial volatility (CRN), since the pathwise recursion is GBM-specific;
+//   the bump is floored at 5% of sigma because the QE step jumps in v0
+// - MCParams::cube feeds the FD repricings; the pathwise run keeps drawing its
+//   own mt19937_64 stream
+// - Every estimator is advanced in lockstep, so intermediate results can be
+//   published at path milestones without re-simulating
 // -----------------------------------------------------------------------------
 
 #include "Greeks.h"
 #include <cmath>
 #include <random>
 #include <algorithm>
+#include <memory>
 #include <vector>
 
-/**
- * @brief Forward declaration of Monte Carlo pricer used in Greeks computations.
- */
-double price_lookback_MC(const MCParams& p, unsigned long seed);
+namespace {
+
+/// Minimum Heston vega bump, relative to sigma.
+constexpr double kHestonVegaRelBump = 0.05;
 
 /**
- * @brief Compute price, delta and vega pathwise in a single Monte Carlo run.
+ * @brief Incremental pathwise estimator of price, delta and vega.
  *
  * This uses a pathwise derivative approach for Delta and Vega while
  * accumulating the discounted payoff for price.
- *
- * @param p Monte Carlo parameters.
- * @param seed RNG seed for reproducibility.
- * @param outPrice Output parameter for price.
- * @param outDelta Output parameter for delta.
- * @param outVega Output parameter for vega.
  */
-static void price_delta_vega_pathwise(const MCParams& p,
-                                      unsigned long seed,
-                                      double& outPrice,
-                                      double& outDelta,
-                                      double& outVega)
-{
-    const int    N  = std::max(1, p.nSteps);
-    const double T  = p.T;
-    const double dt = T / static_cast<double>(N);
-    const double sqrtdt = std::sqrt(dt);
-    const double disc = std::exp(-p.r * T);
+class PathwiseRun {
+public:
+    /**
+     * @param p_ Monte Carlo parameters.
+     * @param seed RNG seed for reproducibility.
+     */
+    PathwiseRun(const MCParams& p_, unsigned long seed)
+        : p(p_), rng(seed), nd(0.0, 1.0)
+    {
+    }
+
+    /**
+     * @brief Simulate `nPaths` more paths.
+     */
+    void advance(int nPaths)
+    {
+        const int    N  = std::max(1, p.nSteps);
+        const double T  = p.T;
+        const double dt = T / static_cast<double>(N);
+        const double sqrtdt = std::sqrt(dt);
 
-    std::mt19937_64 rng(seed);
-    std::normal_distribution<double> nd(0.0, 1.0);
+        for (int i = 0; i < nPaths; ++i) {
 
-    double sumPayoff = 0.0;
-    double sumDelta  = 0.0;
-    double sumVega   = 0.0;
+            double S = p.S0;
 
-    for (int i = 0; i < p.nPaths; ++i) {
+            double Smin = S;
+            double Smax = S;
 
-        double S = p.S0;
+            double D = 0.0;        // dS/dsigma
+            double D_at_min = 0.0;
+            double D_at_max = 0.0;
 
-        double Smin = S;
-        double Smax = S;
+            for (int k = 0; k < N; ++k) {
+                const double Z = nd(rng);
 
-        double D = 0.0;        // dS/dsigma
-        double D_at_min = 0.0;
-        double D_at_max = 0.0;
+                const double step =
+                    std::exp((p.r - 0.5 * p.sigma * p.sigma) * dt + p.sigma * sqrtdt * Z);
 
-        for (int k = 0; k < N; ++k) {
-            const double Z = nd(rng);
+                const double S_next = S * step;
 
-            const double step =
-                std::exp((p.r - 0.5 * p.sigma * p.sigma) * dt + p.sigma * sqrtdt * Z);
+                const double D_next =
+                    S_next * ( (S != 0.0 ? (D / S) : 0.0) + (-p.sigma * dt + sqrtdt * Z) );
 
-            const double S_next = S * step;
+                S = S_next;
+                D = D_next;
 
-            const double D_next =
-                S_next * ( (S != 0.0 ? (D / S) : 0.0) + (-p.sigma * dt + sqrtdt * Z) );
+                if (S < Smin) { Smin = S; D_at_min = D; }
+                if (S > Smax) { Smax = S; D_at_max = D; }
+            }
 
-            S = S_next;
-            D = D_next;
+            const double ST = S;
+            const double DT = D;
 
-            if (S < Smin) { Smin = S; D_at_min = D; }
-            if (S > Smax) { Smax = S; D_at_max = D; }
+            double payoff = 0.0;
+            double dPayoff_dSigma = 0.0;
+
+            if (p.type == LookbackType::Call) {
+                payoff = ST - Smin;
+                dPayoff_dSigma = DT - D_at_min;
+            } else {
+                payoff = Smax - ST;
+                dPayoff_dSigma = D_at_max - DT;
+            }
+
+            const double dPayoff_dS0 = (p.S0 != 0.0) ? (payoff / p.S0) : 0.0;
+
+            sumPayoff   += payoff;
+            sumPayoffSq += payoff * payoff;
+            sumDelta    += dPayoff_dS0;
+            sumVega     += dPayoff_dSigma;
+        }
+
+        done += nPaths;
+    }
+
+    /**
+     * @brief Write the current price, delta, vega and price standard error.
+     */
+    void results(Greeks& g) const
+    {
+        if (done == 0) return;
+
+        const double disc = std::exp(-p.r * p.T);
+        const double invM = 1.0 / static_cast<double>(done);
+
+        g.price = disc * (sumPayoff * invM);
+        g.delta = disc * (sumDelta  * invM);
+        g.vega  = disc * (sumVega   * invM);
+
+        if (done > 1) {
+            const double mean = sumPayoff * invM;
+            const double var  = std::max(0.0, sumPayoffSq * invM - mean * mean)
+                              * done / (done - 1.0);
+            g.stdError = disc * std::sqrt(var * invM);
         }
+    }
 
-        const double ST = S;
-        const double DT = D;
+private:
+    MCParams p;
+    std::mt19937_64 rng;
+    std::normal_distribution<double> nd;
 
-        double payoff = 0.0;
-        double dPayoff_dSigma = 0.0;
+    double sumPayoff   = 0.0;
+    double sumPayoffSq = 0.0;
+    double sumDelta    = 0.0;
+    double sumVega     = 0.0;
+    int done = 0;
+};
 
-        if (p.type == LookbackType::Call) {
-            payoff = ST - Smin;
-            dPayoff_dSigma = DT - D_at_min;
+/**
+ * @brief All estimators behind `compute_greeks_MC`, advanced together.
+ *
+ * Under Black-Scholes, Delta and Vega are pathwise. Under Heston, lookback
+ * payoffs being homogeneous of degree one in S0 makes the pathwise delta
+ * the price divided by S0, and Vega is the sensitivity to the initial
+ * volatility sqrt(v0) = sigma, estimated by central differences with CRN
+ * and a bump of max(bumpSigma, 0.05 * sigma).
+ * Gamma, Rho and Theta use central finite differences with common random
+ * numbers for variance reduction.
+ */
+class GreeksRun {
+public:
+    GreeksRun(const MCParams& base_,
+              double bumpS_,
+              double bumpSigma,
+              double bumpR_,
+              double bumpT_,
+              unsigned long seed)
+        : base(base_),
+          bumpS(bumpS_),
+          bumpR(bumpR_),
+          bumpT(bumpT_),
+          p_0(base_, seed),
+          p_up(bumped(base_, &MCParams::S0, +bumpS_), seed),
+          p_dn(bumped(base_, &MCParams::S0, -bumpS_), seed),
+          p_rUp(bumped(base_, &MCParams::r, +bumpR_), seed),
+          p_rDn(bumped(base_, &MCParams::r, -bumpR_), seed),
+          p_tUp(bumped(base_, &MCParams::T, +bumpT_), seed),
+          p_tDn(bumped(base_, &MCParams::T, -bumpT_), seed)
+    {
+        if (base.model == ModelType::Heston) {
+            MCParams sUp = base, sDn = base;
+            // The QE point mass and branch switch make the CRN price piecewise
+            // continuous in v0, so tiny bumps straddle jumps: floor the bump
+            const double h = std::max(bumpSigma, kHestonVegaRelBump * base.sigma);
+            sUp.sigma = base.sigma + h;
+            sDn.sigma = std::max(0.0, base.sigma - h);
+            sigmaSpread = sUp.sigma - sDn.sigma;
+
+            p_sUp = std::make_unique<LookbackPricer>(sUp, seed);
+            p_sDn = std::make_unique<LookbackPricer>(sDn, seed);
         } else {
-            payoff = Smax - ST;
-            dPayoff_dSigma = D_at_max - DT;
+            pathwise = std::make_unique<PathwiseRun>(base, seed);
         }
+    }
 
-        const double dPayoff_dS0 = (p.S0 != 0.0) ? (payoff / p.S0) : 0.0;
+    /**
+     * @brief Simulate `n` more paths in every estimator (capped at nPaths).
+     */
+    void advance(int n)
+    {
+        n = std::min(n, base.nPaths - done);
+        if (n <= 0) return;
 
-        sumPayoff += payoff;
-        sumDelta  += dPayoff_dS0;
-        sumVega   += dPayoff_dSigma;
+        if (pathwise) pathwise->advance(n);
+        if (p_sUp) { p_sUp->advance(n); p_sDn->advance(n); }
+
+        for (LookbackPricer* pr : { &p_0, &p_up, &p_dn, &p_rUp, &p_rDn, &p_tUp, &p_tDn })
+            pr->advance(n);
+
+        done += n;
     }
 
-    const double invM = 1.0 / static_cast<double>(p.nPaths);
+    /**
+     * @brief Number of paths simulated so far.
+     */
+    int paths() const { return done; }
 
-    outPrice = disc * (sumPayoff * invM);
-    outDelta = disc * (sumDelta  * invM);
-    outVega  = disc * (sumVega   * invM);
-}
+    /**
+     * @brief Greeks over the paths simulated so far.
+     */
+    Greeks current() const
+    {
+        Greeks g{};
+        if (done == 0) return g;
+
+        const MCEstimate e0 = p_0.estimate();
+
+        // PRICE + DELTA & VEGA
+        if (pathwise) {
+            pathwise->results(g);
+        } else {
+            g.price    = e0.price;
+            g.stdError = e0.stdError;
+            g.delta    = (base.S0 != 0.0) ? (e0.price / base.S0) : 0.0;
+            g.vega     = (p_sUp->estimate().price - p_sDn->estimate().price) / sigmaSpread;
+        }
+
+        // GAMMA (FD in S0) with CRN
+        g.gamma = (p_up.estimate().price - 2.0 * e0.price + p_dn.estimate().price)
+                / (bumpS * bumpS);
+
+        // RHO (FD in r) with CRN
+        g.rho = (p_rUp.estimate().price - p_rDn.estimate().price) / (2.0 * bumpR);
+
+        // THETA (FD in T) with CRN
+        g.theta = -(p_tUp.estimate().price - p_tDn.estimate().price) / (2.0 * bumpT);
+
+        return g;
+    }
+
+private:
+    /**
+     * @brief Copy of `p` with one field shifted by `bump`.
+     */
+    static MCParams bumped(const MCParams& p, double MCParams::*field, double bump)
+    {
+        MCParams q = p;
+        q.*field += bump;
+        return q;
+    }
+
+    MCParams base;
+    double bumpS, bumpR, bumpT;
+    double sigmaSpread = 0.0;
+
+    std::unique_ptr<PathwiseRun> pathwise;          // Black-Scholes only
+    LookbackPricer p_0, p_up, p_dn, p_rUp, p_rDn, p_tUp, p_tDn;
+    std::unique_ptr<LookbackPricer> p_sUp, p_sDn;   // Heston only
+
+    int done = 0;
+};
+
+} // namespace
 
 /**
  * @brief Compute option price and Greeks using Monte Carlo.
@@ -112,6 +273,8 @@ static void price_delta_vega_pathwise(const MCParams& p,
  *
  * @param base Base Monte Carlo parameters.
  * @param bumpS Bump for underlying price (Gamma calculation).
+ * @param bumpSigma Bump for volatility (Heston vega only, floored at
+ *                  0.05 * sigma).
  * @param bumpR Bump for interest rate (Rho calculation).
  * @param bumpT Bump for maturity (Theta calculation).
  * @param seed RNG seed for reproducibility.
@@ -124,41 +287,88 @@ Greeks compute_greeks_MC(const MCParams& base,
                          double bumpT,
                          unsigned long seed)
 {
-    Greeks g{};
+    GreeksRun run(base, bumpS, bumpSigma, bumpR, bumpT, seed);
+    run.advance(base.nPaths);
 
-    // PRICE + PATHWISE DELTA & VEGA (single MC run)
-    price_delta_vega_pathwise(base, seed, g.price, g.delta, g.vega);
+    return run.current();
+}
 
-    // GAMMA (FD in S0) with CRN
-    MCParams up = base, dn = base;
-    up.S0 = base.S0 + bumpS;
-    dn.S0 = base.S0 - bumpS;
+/**
+ * @brief Compute price and Greeks, publishing estimates at path milestones.
+ *
+ * All estimators are advanced in lockstep, so the update at `nPaths` paths
+ * is exactly `compute_greeks_MC` run with `nPaths` paths.
+ *
+ * @param base Base Monte Carlo parameters.
+ * @param bumpS Bump for underlying price (Gamma calculation).
+ * @param bumpSigma Bump for volatility (Heston vega only, floored at
+ *                  0.05 * sigma).
+ * @param bumpR Bump for interest rate (Rho calculation).
+ * @param bumpT Bump for maturity (Theta calculation).
+ * @param seed RNG seed for reproducibility.
+ * @param milestones Path counts at which to publish (ascending).
+ * @param onUpdate Callback receiving each update; returning false cancels.
+ * @param cancelled Polled every `kPathBlock` paths; returning true publishes
+ *                  the paths simulated so far and stops.
+ * @return Greeks at the last published update.
+ */
+Greeks compute_greeks_MC_progressive(const MCParams& base,
+                                     double bumpS,
+                                     double bumpSigma,
+                                     double bumpR,
+                                     double bumpT,
+                                     unsigned long seed,
+                                     const std::vector<int>& milestones,
+                                     const GreeksCallback& onUpdate,
+                                     const std::function<bool()>& cancelled)
+{
+    GreeksRun run(base, bumpS, bumpSigma, bumpR, bumpT, seed);
 
-    const double p_up = price_lookback_MC(up, seed);
-    const double p_dn = price_lookback_MC(dn, seed);
-    const double p_0 = price_lookback_MC(base, seed);
+    std::vector<int> targets = milestones;
+    if (targets.empty() || targets.back() < base.nPaths)
+        targets.push_back(base.nPaths);
 
-    g.gamma = (p_up - 2.0 * p_0 + p_dn) / (bumpS * bumpS);
+    Greeks g{};
 
-    // RHO (FD in r) with CRN
-    MCParams rUp = base, rDn = base;
-    rUp.r = base.r + bumpR;
-    rDn.r = base.r - bumpR;
+    for (const int target : targets)
+    {
+        if (target <= run.paths()) continue;
 
-    const double p_rUp = price_lookback_MC(rUp, seed);
-    const double p_rDn = price_lookback_MC(rDn, seed);
+        // Advance block by block so a cancel request is honoured promptly
+        bool stop = false;
+        while (run.paths() < target && !stop) {
+            run.advance(std::min(kPathBlock, target - run.paths()));
+            stop = cancelled && cancelled();
+        }
 
-    g.rho = (p_rUp - p_rDn) / (2.0 * bumpR);
+        g = run.current();
 
-    // THETA (FD in T) with CRN
-    MCParams tUp = base, tDn = base;
-    tUp.T = base.T + bumpT;
-    tDn.T = base.T - bumpT;
+        if (onUpdate && !onUpdate(GreeksProgress{run.paths(), g}))
+            break;
 
-    const double p_tUp = price_lookback_MC(tUp, seed);
-    const double p_tDn = price_lookback_MC(tDn, seed);
+        if (stop) break;
 
-    g.theta = -(p_tUp - p_tDn) / (2.0 * bumpT);
+        if (run.paths() >= base.nPaths) break;
+    }
 
     return g;
 }
+
+/**
+ * @brief Geometric schedule of path milestones ending at `nPaths`.
+ *
+ * @param nPaths Total number of paths.
+ * @param first First milestone.
+ * @param factor Growth factor between milestones (> 1).
+ * @return Ascending milestones, the last being `nPaths`.
+ */
+std::vector<int> progressive_milestones(int nPaths, int first, double factor)
+{
+    std::vector<int> m;
+
+    for (double n = std::max(1, first); n < nPaths; n *= std::max(factor, 1.1))
+        m.push_back(static_cast<int>(n));
+
+    m.push_back(nPaths);
+    return m;
+}
@@ -0,0 +1,157 @@
+#include "HestonMonteCarlo.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+/// Switching threshold on psi between the quadratic and exponential branches.
+constexpr double kPsiCritical = 1.5;
+
+} // namespace
+
+/**
+ * @brief Construct a HestonMonteCarlo object and precompute the QE constants.
+ *
+ * Uses the Andersen (2008) QE scheme for the variance with the central
+ * (gamma1 = gamma2 = 1/2) discretization of the integrated variance.
+ *
+ * @param S0_ Initial asset price.
+ * @param r_ Risk-free rate.
+ * @param v0_ Initial variance.
+ * @param h Variance-process parameters.
+ * @param T_ Time to maturity.
+ * @param nSteps_ Number of time steps per path.
+ * @param seed RNG seed.
+ */
+HestonMonteCarlo::HestonMonteCarlo(const double S0_,
+                                   const double r_,
+                                   const double v0_,
+                                   const HestonParams& h,
+                                   const double T_,
+                                   const int nSteps_,
+                                   const unsigned long seed)
+    : logS0(std::log(S0_)),
+      v0(v0_),
+      nSteps(std::max(1, nSteps_)),
+      rng(seed),
+      normal(0.0, 1.0),
+      uniform(0.0, 1.0)
+{
+    const double dt = T_ / nSteps;
+    const double E  = std::exp(-h.kappa * dt);
+    const double xi2 = h.xi * h.xi;
+
+    // Conditional moments of v(t+dt) given v(t); kappa -> 0 gives m = v and
+    // s2 = v xi^2 dt
+    mA = h.theta * (1.0 - E);
+    mB = E;
+
+    if (h.kappa > 0.0) {
+        s2A = h.theta * xi2 * (1.0 - E) * (1.0 - E) / (2.0 * h.kappa);
+        s2B = xi2 * E * (1.0 - E) / h.kappa;
+    } else {
+        s2A = 0.0;
+        s2B = xi2 * dt;
+    }
+
+    // Log-spot coefficients; with xi = 0 the variance is deterministic and
+    // the spot/variance correlation terms drop out
+    const double half = 0.5 * dt;
+    deterministicVariance = (h.xi == 0.0);
+
+    if (deterministicVariance) {
+        K0 = r_ * dt;
+        K1 = -0.5 * half;
+        K2 = K1;
+        K3 = half;
+        K4 = K3;
+    } else {
+        const double rhoOverXi = h.rho / h.xi;
+
+        K0 = r_ * dt - rhoOverXi * h.kappa * h.theta * dt;
+        K1 = half * (h.kappa * rhoOverXi - 0.5) - rhoOverXi;
+        K2 = half * (h.kappa * rhoOverXi - 0.5) + rhoOverXi;
+        K3 = half * (1.0 - h.rho * h.rho);
+        K4 = K3;
+    }
+}
+
+/**
+ * @brief Simulate a block of paths with the QE scheme.
+ *
+ * Each step first draws the random numbers of every lane, then updates
+ * the variance and log-spot arrays in tight loops over the lanes.
+ * Extremes are tracked in log space and exponentiated once at the end.
+ */
+void HestonMonteCarlo::simulate_block(const int nPaths,
+                                      double* ST,
+                                      double* Smin,
+                                      double* Smax)
+{
+    const std::size_t n = static_cast<std::size_t>(nPaths);
+
+    logS.assign(n, logS0);
+    v.assign(n, v0);
+    vNext.resize(n);
+    logMin.assign(n, logS0);
+    logMax.assign(n, logS0);
+    Zv.resize(n);
+    U.resize(n);
+    Zs.resize(n);
+
+    for (int k = 0; k < nSteps; ++k)
+    {
+        for (std::size_t i = 0; i < n; ++i) Zv[i] = normal(rng);
+        for (std::size_t i = 0; i < n; ++i) U[i]  = uniform(rng);
+        for (std::size_t i = 0; i < n; ++i) Zs[i] = normal(rng);
+
+        // Variance step (QE)
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const double m = mA + mB * v[i];
+
+            // Deterministic step, or variance absorbed at zero
+            if (deterministicVariance || m <= 0.0) {
+                vNext[i] = std::max(0.0, m);
+                continue;
+            }
+
+            const double s2  = s2A + s2B * v[i];
+            const double psi = s2 / (m * m);
+
+            if (psi <= kPsiCritical) {
+                // Quadratic branch: v' = a (b + Z)^2
+                const double invPsi = 2.0 / psi;
+                const double b2 = invPsi - 1.0 + std::sqrt(invPsi * (invPsi - 1.0));
+                const double a  = m / (1.0 + b2);
+                const double bz = std::sqrt(b2) + Zv[i];
+                vNext[i] = a * bz * bz;
+            } else {
+                // Exponential branch: point mass at zero plus exponential tail
+                const double p    = (psi - 1.0) / (psi + 1.0);
+                const double beta = (1.0 - p) / m;
+                vNext[i] = (U[i] <= p) ? 0.0 : std::log((1.0 - p) / (1.0 - U[i])) / beta;
+            }
+        }
+
+        // Log-spot step and running extremes
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            logS[i] += K0 + K1 * v[i] + K2 * vNext[i]
+                     + std::sqrt(K3 * v[i] + K4 * vNext[i]) * Zs[i];
+
+            logMin[i] = std::min(logMin[i], logS[i]);
+            logMax[i] = std::max(logMax[i], logS[i]);
+        }
+
+        v.swap(vNext);
+    }
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        ST[i]   = std::exp(logS[i]);
+        Smin[i] = std::exp(logMin[i]);
+        Smax[i] = std::exp(logMax[i]);
+    }
+}
@@ -0,0 +1,243 @@
+#include "ImpliedVolatility.h"
+#include "ExactLookbackPrice.h"
+#include "NormalCube.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Safeguarded Newton iteration run in lockstep over all quotes.
+ *
+ * `evaluate(sigma, active, price, vega)` must fill `price` and `vega` for
+ * every active quote at its current `sigma`. The bracket ends are evaluated
+ * first; a quote whose price - quote does not change sign over the bracket
+ * is reported as not converged. Inside the bracket each Newton step that
+ * would leave it is replaced by a bisection step.
+ */
+template <class Evaluate>
+std::vector<ImpliedVolResult> solve(const std::vector<LookbackQuote>& quotes,
+                                    const ImpliedVolSettings& s,
+                                    Evaluate evaluate)
+{
+    const std::size_t n = quotes.size();
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+
+    std::vector<ImpliedVolResult> res(n, ImpliedVolResult{nan, 0, false});
+    std::vector<double> sigma(n), lo(n, s.sigmaMin), hi(n, s.sigmaMax), fLo(n);
+    std::vector<double> price(n), vega(n);
+    std::vector<char> active(n, 1);
+
+    // Bracket ends
+    sigma = lo;
+    evaluate(sigma, active, price, vega);
+    for (std::size_t i = 0; i < n; ++i) fLo[i] = price[i] - quotes[i].price;
+
+    sigma = hi;
+    evaluate(sigma, active, price, vega);
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const double fHi = price[i] - quotes[i].price;
+
+        if (!std::isfinite(fLo[i]) || !std::isfinite(fHi) || fLo[i] * fHi > 0.0) {
+            res[i].sigma = (std::fabs(fLo[i]) < std::fabs(fHi)) ? lo[i] : hi[i];
+            active[i] = 0;
+        } else if (fLo[i] == 0.0 || fHi == 0.0) {
+            res[i] = ImpliedVolResult{fLo[i] == 0.0 ? lo[i] : hi[i], 0, true};
+            active[i] = 0;
+        } else {
+            sigma[i] = std::min(std::max(s.sigmaInit, lo[i]), hi[i]);
+        }
+    }
+
+    // Newton with bisection fallback
+    for (int it = 1; it <= s.maxIter; ++it)
+    {
+        if (std::none_of(active.begin(), active.end(), [](char a) { return a != 0; }))
+            break;
+
+        evaluate(sigma, active, price, vega);
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            if (!active[i]) continue;
+
+            res[i].iterations = it;
+            const double f = price[i] - quotes[i].price;
+
+            if (std::fabs(f) <= s.priceTol) {
+                res[i].sigma = sigma[i];
+                res[i].converged = true;
+                active[i] = 0;
+                continue;
+            }
+
+            // Keep the root inside [lo, hi]
+            if ((f < 0.0) == (fLo[i] < 0.0)) lo[i] = sigma[i];
+            else                             hi[i] = sigma[i];
+
+            if (hi[i] - lo[i] <= s.sigmaTol) {
+                res[i].sigma = 0.5 * (lo[i] + hi[i]);
+                res[i].converged = true;
+                active[i] = 0;
+                continue;
+            }
+
+            const double newton = sigma[i] - f / vega[i];
+            const bool inside = vega[i] != 0.0 && newton > lo[i] && newton < hi[i];
+
+            sigma[i] = inside ? newton : 0.5 * (lo[i] + hi[i]);
+        }
+    }
+
+    for (std::size_t i = 0; i < n; ++i)
+        if (active[i]) res[i].sigma = sigma[i];
+
+    return res;
+}
+
+} // namespace
+
+/**
+ * @brief Implied volatilities from the exact formulas.
+ *
+ * @param quotes Quotes to invert.
+ * @param settings Solver controls.
+ * @return One result per quote.
+ */
+std::vector<ImpliedVolResult> implied_vol_exact(const std::vector<LookbackQuote>& quotes,
+                                                const ImpliedVolSettings& settings)
+{
+    auto evaluate = [&quotes](const std::vector<double>& sigma,
+                              const std::vector<char>& active,
+                              std::vector<double>& price,
+                              std::vector<double>& vega)
+    {
+        for (std::size_t i = 0; i < quotes.size(); ++i)
+        {
+            if (!active[i]) continue;
+            const LookbackQuote& q = quotes[i];
+
+            if (q.type == LookbackType::Call) {
+                price[i] = lookback_call_exact(q.S0, q.Sext, q.r, sigma[i], q.T);
+                vega[i]  = lookback_call_exact_vega(q.S0, q.Sext, q.r, sigma[i], q.T);
+            } else {
+                price[i] = lookback_put_exact(q.S0, q.Sext, q.r, sigma[i], q.T);
+                vega[i]  = lookback_put_exact_vega(q.S0, q.Sext, q.r, sigma[i], q.T);
+            }
+        }
+    };
+
+    return solve(quotes, settings, evaluate);
+}
+
+/**
+ * @brief Implied volatilities from Monte Carlo prices with fixed normals.
+ *
+ * Each evaluation makes one pass over the normals, path by path, pricing
+ * every active quote on the path while it is in cache. Without a cube the
+ * normals are regenerated from `seed` on each pass: the same common random
+ * numbers with O(nSteps) memory. Paths follow the
+ * `MonteCarlo` recursion exactly; vega is the pathwise derivative
+ * dS/dsigma = S (W - sigma t).
+ *
+ * @param quotes Quotes to invert.
+ * @param nPaths Number of Monte Carlo paths.
+ * @param nSteps Number of time steps per path.
+ * @param seed RNG seed.
+ * @param cube Optional pre-generated normals matching seed and shape.
+ * @param settings Solver controls.
+ * @return One result per quote.
+ */
+std::vector<ImpliedVolResult> implied_vol_MC(const std::vector<LookbackQuote>& quotes,
+                                             const int nPaths,
+                                             const int nSteps,
+                                             const unsigned long seed,
+                                             const NormalCube* cube,
+                                             const ImpliedVolSettings& settings)
+{
+    // Common random numbers: read from the cube, or redrawn from `seed` on
+    // every evaluation so only one path of normals is held in memory
+    if (cube && !cube->matches(seed, nPaths, nSteps, CubeRng::MT19937))
+        throw std::invalid_argument("normal cube does not match seed, shape or RNG");
+
+    std::vector<double> row(static_cast<std::size_t>(nSteps));
+
+    const std::size_t n = quotes.size();
+    std::vector<double> drift(n), diffusion(n), sumPayoff(n), sumVega(n);
+    std::vector<std::size_t> idx;
+
+    auto evaluate = [&](const std::vector<double>& sigma,
+                        const std::vector<char>& active,
+                        std::vector<double>& price,
+                        std::vector<double>& vega)
+    {
+        idx.clear();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            if (!active[i]) continue;
+            idx.push_back(i);
+
+            const double dt = quotes[i].T / nSteps;
+            drift[i]     = (quotes[i].r - 0.5 * sigma[i] * sigma[i]) * dt;
+            diffusion[i] = sigma[i] * std::sqrt(dt);
+            sumPayoff[i] = 0.0;
+            sumVega[i]   = 0.0;
+        }
+
+        std::mt19937 rng(seed);
+        std::normal_distribution<double> normal(0.0, 1.0);
+
+        for (int p = 0; p < nPaths; ++p)
+        {
+            const double* z = row.data();
+            if (cube) {
+                z = cube->path(p);
+            } else {
+                for (double& x : row) x = normal(rng);
+            }
+
+            for (const std::size_t i : idx)
+            {
+                const LookbackQuote& q = quotes[i];
+                const double dt = q.T / nSteps;
+                const double sqrtdt = std::sqrt(dt);
+
+                double S = q.S0;
+                double W = 0.0;        // Brownian motion
+                double D = 0.0;        // dS/dsigma
+
+                double Smin = std::min(q.S0, q.Sext), D_at_min = 0.0;
+                double Smax = std::max(q.S0, q.Sext), D_at_max = 0.0;
+
+                for (int k = 0; k < nSteps; ++k)
+                {
+                    S *= std::exp(drift[i] + diffusion[i] * z[k]);
+                    W += sqrtdt * z[k];
+                    D  = S * (W - sigma[i] * (k + 1) * dt);
+
+                    if (S < Smin) { Smin = S; D_at_min = D; }
+                    if (S > Smax) { Smax = S; D_at_max = D; }
+                }
+
+                sumPayoff[i] += payoff_lookback(S, Smin, Smax, q.type);
+                sumVega[i]   += (q.type == LookbackType::Call) ? (D - D_at_min)
+                                                               : (D_at_max - D);
+            }
+        }
+
+        for (const std::size_t i : idx)
+        {
+            const double disc = std::exp(-quotes[i].r * quotes[i].T);
+            price[i] = disc * (sumPayoff[i] / nPaths);
+            vega[i]  = disc * (sumVega[i] / nPaths);
+        }
+    };
+
+    return solve(quotes, settings, evaluate);
+}
@@ -0,0 +1,208 @@
+// The implementation always exports the API; this is the only place the
+// macro is set, so builds need no extra flag (and tolerate one)
+#ifndef LOOKBACK_BUILD_DLL
+#define LOOKBACK_BUILD_DLL
+#endif
+#include "LookbackCApi.h"
+#include "LookbackOption.h"
+#include "Greeks.h"
+#include "ExactLookbackPrice.h"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <limits>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Check that a batch of option types only holds 1 (Call) or 2 (Put).
+ */
+bool valid_types(const size_t n, const int32_t* type)
+{
+    return std::all_of(type, type + n, [](int32_t t) { return t == 1 || t == 2; });
+}
+
+/**
+ * @brief Check that a seed survives the narrowing to the pricers' `unsigned long`
+ *        (32 bits on Windows), so no two seeds silently share a stream.
+ */
+bool valid_seed(const uint64_t seed)
+{
+    return seed <= std::numeric_limits<unsigned long>::max();
+}
+
+/**
+ * @brief Run `body(i)` for every trade, split into contiguous ranges over
+ *        `nThreads` threads. Exceptions never cross the C boundary.
+ */
+template <class Body>
+int32_t for_each_trade(const size_t n, const int32_t nThreads, Body body)
+{
+    std::atomic<bool> failed{false};
+
+    auto run = [&](size_t begin, size_t end) {
+        try {
+            for (size_t i = begin; i < end && !failed; ++i) body(i);
+        } catch (...) {
+            failed = true;
+        }
+    };
+
+    const size_t nWorkers = std::min<size_t>(n, static_cast<size_t>(std::max(1, nThreads)));
+
+    if (nWorkers <= 1) {
+        run(0, n);
+    } else {
+        std::vector<std::thread> workers;
+        const size_t per = (n + nWorkers - 1) / nWorkers;
+
+        try {
+            for (size_t w = 0; w < nWorkers; ++w)
+                workers.emplace_back(run, w * per, std::min(n, (w + 1) * per));
+        } catch (...) {
+            failed = true;
+        }
+
+        for (std::thread& t : workers) t.join();
+    }
+
+    return failed ? LB_INTERNAL_ERROR : LB_OK;
+}
+
+/**
+ * @brief Monte Carlo parameters of trade `i`.
+ */
+MCParams trade_params(const size_t i,
+                      const double* S0,
+                      const double* r,
+                      const double* sigma,
+                      const double* T,
+                      const int32_t* type,
+                      const int32_t nPaths,
+                      const int32_t nSteps)
+{
+    MCParams p;
+    p.S0     = S0[i];
+    p.r      = r[i];
+    p.sigma  = sigma[i];
+    p.T      = T[i];
+    p.type   = (type[i] == 1 ? LookbackType::Call : LookbackType::Put);
+    p.nPaths = nPaths;
+    p.nSteps = nSteps;
+    return p;
+}
+
+} // namespace
+
+int32_t lb_abi_version(void)
+{
+    return LB_ABI_VERSION;
+}
+
+const char* lb_status_string(const int32_t status)
+{
+    switch (status) {
+        case LB_OK:               return "ok";
+        case LB_INVALID_ARGUMENT: return "invalid argument";
+        case LB_INTERNAL_ERROR:   return "internal error";
+        default:                  return "unknown status";
+    }
+}
+
+int32_t lb_price_mc(const size_t n,
+                    const double* S0,
+                    const double* r,
+                    const double* sigma,
+                    const double* T,
+                    const int32_t* type,
+                    const int32_t nPaths,
+                    const int32_t nSteps,
+                    const uint64_t seed,
+                    const int32_t nThreads,
+                    double* price,
+                    double* stdError)
+{
+    if (n == 0) return LB_OK;
+    if (!S0 || !r || !sigma || !T || !type || !price || nPaths < 1 || nSteps < 1 ||
+        !valid_seed(seed) || !valid_types(n, type))
+        return LB_INVALID_ARGUMENT;
+
+    return for_each_trade(n, nThreads, [&](size_t i) {
+        LookbackPricer pricer(trade_params(i, S0, r, sigma, T, type, nPaths, nSteps),
+                              static_cast<unsigned long>(seed));
+        pricer.advance(nPaths);
+
+        const MCEstimate e = pricer.estimate();
+        price[i] = e.price;
+        if (stdError) stdError[i] = e.stdError;
+    });
+}
+
+int32_t lb_greeks_mc(const size_t n,
+                     const double* S0,
+                     const double* r,
+                     const double* sigma,
+                     const double* T,
+                     const int32_t* type,
+                     const int32_t nPaths,
+                     const int32_t nSteps,
+                     const double bumpS,
+                     const double bumpSigma,
+                     const double bumpR,
+                     const double bumpT,
+                     const uint64_t seed,
+                     const int32_t nThreads,
+                     double* price,
+                     double* stdError,
+                     double* delta,
+                     double* gamma,
+                     double* theta,
+                     double* rho,
+                     double* vega)
+{
+    if (n == 0) return LB_OK;
+    if (!S0 || !r || !sigma || !T || !type || !price || nPaths < 1 || nSteps < 1 ||
+        bumpS <= 0.0 || bumpR <= 0.0 || bumpT <= 0.0 || !valid_seed(seed) ||
+        !valid_types(n, type))
+        return LB_INVALID_ARGUMENT;
+
+    return for_each_trade(n, nThreads, [&](size_t i) {
+        const Greeks g = compute_greeks_MC(trade_params(i, S0, r, sigma, T, type, nPaths, nSteps),
+                                           bumpS, bumpSigma, bumpR, bumpT,
+                                           static_cast<unsigned long>(seed));
+        price[i] = g.price;
+        if (stdError) stdError[i] = g.stdError;
+        if (delta)    delta[i]    = g.delta;
+        if (gamma)    gamma[i]    = g.gamma;
+        if (theta)    theta[i]    = g.theta;
+        if (rho)      rho[i]      = g.rho;
+        if (vega)     vega[i]     = g.vega;
+    });
+}
+
+int32_t lb_exact(const size_t n,
+                 const double* S0,
+                 const double* Sext,
+                 const double* r,
+                 const double* sigma,
+                 const double* T,
+                 const int32_t* type,
+                 double* price,
+                 double* vega)
+{
+    if (n == 0) return LB_OK;
+    if (!S0 || !Sext || !r || !sigma || !T || !type || !price || !valid_types(n, type))
+        return LB_INVALID_ARGUMENT;
+
+    return for_each_trade(n, 1, [&](size_t i) {
+        if (type[i] == 1) {
+            price[i] = lookback_call_exact(S0[i], Sext[i], r[i], sigma[i], T[i]);
+            if (vega) vega[i] = lookback_call_exact_vega(S0[i], Sext[i], r[i], sigma[i], T[i]);
+        } else {
+            price[i] = lookback_put_exact(S0[i], Sext[i], r[i], sigma[i], T[i]);
+            if (vega) vega[i] = lookback_put_exact_vega(S0[i], Sext[i], r[i], sigma[i], T[i]);
+        }
+    });
+}
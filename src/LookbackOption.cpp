@@ -1,7 +1,8 @@
 #include "LookbackOption.h"
-#include "MonteCarlo.h"
+#include "PathModel.h"
 #include <algorithm>
 #include <cmath>
+#include <memory>
 #include <vector>
 
 /**
@@ -25,41 +26,101 @@ double payoff_lookback(const double ST,
 }
 
 /**
- * @brief Monte Carlo pricing of a floating-strike lookback option.
+ * @brief Prepare an incremental Monte Carlo run.
  *
- * @param params Monte Carlo parameters (see `MCParams`).
+ * @param params_ Monte Carlo parameters (see `MCParams`).
  * @param seed RNG seed for reproducibility.
- * @return Discounted expected payoff (price).
  */
-double price_lookback_MC(const MCParams& params,
-                         const unsigned long seed)
+LookbackPricer::LookbackPricer(const MCParams& params_,
+                               const unsigned long seed)
+    : params(params_),
+      model(make_path_model(params_, seed))
 {
-    MonteCarlo mc(params.S0,
-                  params.r,
-                  params.sigma,
-                  params.T,
-                  params.nSteps,
-                  seed);
+    // Paths are simulated in blocks to keep the SoA buffers cache-sized
+    const int blockSize = std::max(0, std::min(params.nPaths, kPathBlock));
+    ST.resize(blockSize);
+    Smin.resize(blockSize);
+    Smax.resize(blockSize);
+}
 
-    double sumPayoff = 0.0;
+LookbackPricer::~LookbackPricer() = default;
+LookbackPricer::LookbackPricer(LookbackPricer&&) noexcept = default;
+LookbackPricer& LookbackPricer::operator=(LookbackPricer&&) noexcept = default;
 
-    for (int p = 0; p < params.nPaths; ++p)
+/**
+ * @brief Simulate `n` more paths and accumulate their payoffs.
+ *
+ * The engine is always called on the same partition of the run into
+ * `kPathBlock` blocks; a partial advance is served from the buffered block,
+ * so the paths never depend on how the caller splits the run.
+ *
+ * @param n Number of additional paths.
+ */
+void LookbackPricer::advance(const int n)
+{
+    const int target = std::min(params.nPaths, done + std::max(0, n));
+    const int blockSize = static_cast<int>(ST.size());
+
+    while (done < target)
     {
-        const std::vector<double> path = mc.generate_path();
+        // Buffer exhausted: simulate the next whole block of the run
+        if (done == simulated) {
+            blockLen = std::min(blockSize, params.nPaths - simulated);
+            model->simulate_block(blockLen, ST.data(), Smin.data(), Smax.data());
+            simulated += blockLen;
+        }
+
+        const int first = blockLen - (simulated - done);
+        const int m = std::min(simulated, target) - done;
 
-        // Extract terminal price and path extremes
-        const double ST   = path.back();
-        const double Smin = *std::min_element(path.begin(), path.end());
-        const double Smax = *std::max_element(path.begin(), path.end());
+        // Compute and accumulate payoff for each path taken from the block
+        for (int p = first; p < first + m; ++p)
+        {
+            const double payoff = payoff_lookback(ST[p], Smin[p], Smax[p], params.type);
+            sumPayoff   += payoff;
+            sumPayoffSq += payoff * payoff;
+        }
 
-        // Compute and accumulate payoff for the given path
-        sumPayoff += payoff_lookback(ST, Smin, Smax, params.type);
+        done += m;
     }
+}
+
+/**
+ * @brief Current price estimate and standard error.
+ *
+ * @return Discounted mean payoff over the paths simulated so far.
+ */
+MCEstimate LookbackPricer::estimate() const
+{
+    MCEstimate e{0.0, 0.0, done};
+    if (done == 0) return e;
+
+    const double disc = std::exp(-params.r * params.T);
+    const double mean = sumPayoff / done;
 
-    // Discount the average payoff to present value
-    const double discountedPayoff =
-        std::exp(-params.r * params.T) * (sumPayoff / params.nPaths);
+    e.price = disc * mean;
+
+    if (done > 1) {
+        const double var = std::max(0.0, sumPayoffSq / done - mean * mean)
+                         * done / (done - 1.0);
+        e.stdError = disc * std::sqrt(var / done);
+    }
 
-    return discountedPayoff;
+    return e;
 }
 
+/**
+ * @brief Monte Carlo pricing of a floating-strike lookback option.
+ *
+ * @param params Monte Carlo parameters (see `MCParams`).
+ * @param seed RNG seed for reproducibility.
+ * @return Discounted expected payoff (price).
+ */
+double price_lookback_MC(const MCParams& params,
+                         const unsigned long seed)
+{
+    LookbackPricer pricer(params, seed);
+    pricer.advance(params.nPaths);
+
+    return pricer.estimate().price;
+}
@@ -0,0 +1,96 @@
+#include "MappedFile.h"
+#include <stdexcept>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Map a whole file read-only.
+ *
+ * The mapping is shared, so concurrent processes mapping the same file
+ * use the same physical pages.
+ *
+ * @param path File to map.
+ */
+MappedFile::MappedFile(const std::string& path)
+{
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING,
+                              FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        throw std::runtime_error("cannot open " + path);
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize)) {
+        CloseHandle(file);
+        throw std::runtime_error("cannot stat " + path);
+    }
+
+    fileHandle = file;
+    length = static_cast<std::size_t>(fileSize.QuadPart);
+    if (length == 0) return;
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        CloseHandle(file);
+        throw std::runtime_error("cannot map " + path);
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        throw std::runtime_error("cannot map " + path);
+    }
+
+    mapHandle = mapping;
+    bytes = static_cast<const unsigned char*>(view);
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw std::runtime_error("cannot open " + path);
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        throw std::runtime_error("cannot stat " + path);
+    }
+
+    length = static_cast<std::size_t>(st.st_size);
+    if (length == 0) {
+        ::close(fd);
+        return;
+    }
+
+    void* view = ::mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);   // the mapping keeps its own reference
+
+    if (view == MAP_FAILED)
+        throw std::runtime_error("cannot map " + path);
+
+    ::madvise(view, length, MADV_SEQUENTIAL);
+    bytes = static_cast<const unsigned char*>(view);
+#endif
+}
+
+/**
+ * @brief Unmap the file.
+ */
+MappedFile::~MappedFile()
+{
+#ifdef _WIN32
+    if (bytes) UnmapViewOfFile(bytes);
+    if (mapHandle) CloseHandle(mapHandle);
+    if (fileHandle) CloseHandle(fileHandle);
+#else
+    if (bytes) ::munmap(const_cast<unsigned char*>(bytes), length);
+#endif
+}
@@ -1,4 +1,5 @@
 #include "MonteCarlo.h"
+#include <algorithm>
 #include <cmath>
 #include <vector>
 
@@ -51,7 +52,8 @@ std::vector<double> MonteCarlo::generate_path()
     // Simulate the path
     for (int i = 0; i < nSteps; ++i)
     {
-        const double Z = normal(rng);  // standard normal increment
+        // standard normal increment
+        const double Z = presetZ ? *presetZ++ : normal(rng);
 
         // Euler–Maruyama scheme for Geometric Brownian Motion
         S *= std::exp(drift + diffusion * Z);
@@ -61,3 +63,36 @@ std::vector<double> MonteCarlo::generate_path()
 
     return path;
 }
+
+/**
+ * @brief Read normal increments from memory instead of the RNG.
+ *
+ * @param Z Pre-generated normals, consumed nSteps per path.
+ */
+void MonteCarlo::use_normals(const double* Z)
+{
+    presetZ = Z;
+}
+
+/**
+ * @brief Simulate a block of paths and extract the lookback statistics.
+ *
+ * @param nPaths Number of paths in the block.
+ * @param ST Output terminal prices.
+ * @param Smin Output path minima.
+ * @param Smax Output path maxima.
+ */
+void MonteCarlo::simulate_block(const int nPaths,
+                                double* ST,
+                                double* Smin,
+                                double* Smax)
+{
+    for (int p = 0; p < nPaths; ++p)
+    {
+        const std::vector<double> path = generate_path();
+
+        ST[p]   = path.back();
+        Smin[p] = *std::min_element(path.begin(), path.end());
+        Smax[p] = *std::max_element(path.begin(), path.end());
+    }
+}
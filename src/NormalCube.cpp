@@ -0,0 +1,161 @@
+#include "NormalCube.h"
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <string>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+constexpr char kMagic[8] = {'L', 'B', 'N', 'C', 'U', 'B', 'E', '1'};
+
+/**
+ * @brief Fixed 64-byte file header; normals start right after it.
+ */
+struct CubeHeader {
+    char magic[8];
+    std::uint32_t headerSize;
+    std::uint32_t rng;
+    std::uint64_t seed;
+    std::uint64_t nPaths;
+    std::uint64_t nSteps;
+    std::uint64_t reserved[3];
+};
+
+static_assert(sizeof(CubeHeader) == 64, "cube header must stay 64 bytes");
+
+/**
+ * @brief Draw the cube's normals path by path and stream them to `out`.
+ */
+void write_normals(std::ofstream& out,
+                   const unsigned long seed,
+                   const int nPaths,
+                   const int nSteps)
+{
+    std::mt19937 rng(seed);
+    std::normal_distribution<double> normal(0.0, 1.0);
+
+    std::vector<double> row(static_cast<std::size_t>(nSteps));
+
+    for (int p = 0; p < nPaths; ++p)
+    {
+        for (double& z : row) z = normal(rng);
+        out.write(reinterpret_cast<const char*>(row.data()),
+                  static_cast<std::streamsize>(row.size() * sizeof(double)));
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Generate a cube file and atomically move it into place.
+ */
+void NormalCube::generate(const std::string& path,
+                          const unsigned long seed,
+                          const int nPaths,
+                          const int nSteps,
+                          const CubeRng rng)
+{
+    // Unique per writer, so concurrent generators never share a temp file
+    std::random_device entropy;
+    const std::string tmpPath = path + "." + std::to_string(entropy()) + "."
+        + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count())
+        + ".tmp";
+
+    {
+        std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!out)
+            throw std::runtime_error("cannot create " + tmpPath);
+
+        CubeHeader h{};
+        std::memcpy(h.magic, kMagic, sizeof(kMagic));
+        h.headerSize = sizeof(CubeHeader);
+        h.rng    = static_cast<std::uint32_t>(rng);
+        h.seed   = seed;
+        h.nPaths = static_cast<std::uint64_t>(nPaths);
+        h.nSteps = static_cast<std::uint64_t>(nSteps);
+        out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+
+        write_normals(out, seed, nPaths, nSteps);
+
+        if (!out) {
+            out.close();
+            std::error_code ignored;
+            std::filesystem::remove(tmpPath, ignored);
+            throw std::runtime_error("cannot write " + tmpPath);
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tmpPath, path, ec);
+    if (!ec) return;
+
+    // The target may be held open by processes mapping a cube another
+    // writer just produced: accept it if it serves this request
+    std::error_code ignored;
+    std::filesystem::remove(tmpPath, ignored);
+
+    try {
+        const NormalCube existing(path);
+        if (existing.matches(seed, nPaths, nSteps, rng)) return;
+    } catch (const std::runtime_error&) {
+    }
+
+    throw std::runtime_error("cannot move " + tmpPath + " to " + path + ": " + ec.message());
+}
+
+/**
+ * @brief Map a cube file and validate its header against its size.
+ */
+NormalCube::NormalCube(const std::string& path)
+    : file(path)
+{
+    if (file.size() < sizeof(CubeHeader))
+        throw std::runtime_error(path + " is not a normal cube");
+
+    CubeHeader h;
+    std::memcpy(&h, file.data(), sizeof(h));
+
+    if (std::memcmp(h.magic, kMagic, sizeof(kMagic)) != 0 ||
+        h.headerSize != sizeof(CubeHeader) ||
+        h.rng != static_cast<std::uint32_t>(CubeRng::MT19937))
+        throw std::runtime_error(path + " is not a normal cube");
+
+    // Counts must fit the int accessors, and the size must not wrap around
+    const std::uint64_t maxCount = static_cast<std::uint64_t>(std::numeric_limits<int>::max());
+    const std::uint64_t maxNormals =
+        (std::numeric_limits<std::uint64_t>::max() - sizeof(CubeHeader)) / sizeof(double);
+
+    if (h.nPaths > maxCount || h.nSteps > maxCount ||
+        (h.nSteps != 0 && h.nPaths > maxNormals / h.nSteps))
+        throw std::runtime_error(path + " has an invalid cube shape");
+
+    const std::uint64_t expected =
+        sizeof(CubeHeader) + h.nPaths * h.nSteps * sizeof(double);
+    if (file.size() != expected)
+        throw std::runtime_error(path + " is truncated");
+
+    normals  = reinterpret_cast<const double*>(file.data() + sizeof(CubeHeader));
+    cubeSeed = static_cast<unsigned long>(h.seed);
+    nPaths   = static_cast<int>(h.nPaths);
+    nSteps   = static_cast<int>(h.nSteps);
+    cubeRng  = static_cast<CubeRng>(h.rng);
+}
+
+/**
+ * @brief Check whether the cube holds the normals of a run.
+ */
+bool NormalCube::matches(const unsigned long seed,
+                         const int nPaths_,
+                         const int nSteps_,
+                         const CubeRng rng) const
+{
+    return seed == cubeSeed
+        && rng == cubeRng
+        && nSteps_ == nSteps
+        && nPaths_ <= nPaths;
+}
@@ -0,0 +1,55 @@
+#include "PathModel.h"
+#include "MonteCarlo.h"
+#include "HestonMonteCarlo.h"
+#include "NormalCube.h"
+#include <cmath>
+#include <stdexcept>
+
+/**
+ * @brief Build the path engine selected by `params.model`.
+ *
+ * @param params Monte Carlo parameters.
+ * @param seed RNG seed.
+ * @return Engine ready to simulate paths.
+ * @throw std::invalid_argument if `params.cube` cannot serve this run, or
+ *        if the Heston parameters are out of range.
+ */
+std::unique_ptr<PathModel> make_path_model(const MCParams& params,
+                                           const unsigned long seed)
+{
+    if (params.model == ModelType::Heston)
+    {
+        if (params.cube)
+            throw std::invalid_argument("normal cube requires the Black-Scholes model");
+
+        const HestonParams& h = params.heston;
+        if (h.kappa < 0.0 || h.theta < 0.0 || h.xi < 0.0 || std::fabs(h.rho) > 1.0)
+            throw std::invalid_argument("Heston parameters require kappa, theta, xi >= 0 and |rho| <= 1");
+
+        return std::make_unique<HestonMonteCarlo>(params.S0,
+                                                  params.r,
+                                                  params.sigma * params.sigma,
+                                                  params.heston,
+                                                  params.T,
+                                                  params.nSteps,
+                                                  seed);
+    }
+
+    auto mc = std::make_unique<MonteCarlo>(params.S0,
+                                           params.r,
+                                           params.sigma,
+                                           params.T,
+                                           params.nSteps,
+                                           seed);
+
+    // Stream the increments from the mapped cube instead of regenerating them
+    if (params.cube)
+    {
+        if (!params.cube->matches(seed, params.nPaths, params.nSteps, CubeRng::MT19937))
+            throw std::invalid_argument("normal cube does not match seed, shape or RNG");
+
+        mc->use_normals(params.cube->data());
+    }
+
+    return mc;
+}
@@ -0,0 +1,569 @@
+#include "TradeIO.h"
+#include "MappedFile.h"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+constexpr char kMagic[8] = {'L', 'B', 'C', 'O', 'L', 'S', '0', '1'};
+
+/**
+ * @brief Content of a binary columnar file.
+ */
+enum class FileKind : std::uint32_t {
+    Trades  = 1,
+    Results = 2
+};
+
+/**
+ * @brief Fixed 64-byte header of a binary columnar file.
+ */
+struct ColumnHeader {
+    char magic[8];
+    std::uint32_t headerSize;
+    std::uint32_t kind;
+    std::uint64_t nRows;
+    std::uint64_t groupRows;
+    std::uint64_t reserved[4];
+};
+
+static_assert(sizeof(ColumnHeader) == 64, "column header must stay 64 bytes");
+
+// Column widths in bytes, in file order
+const std::vector<std::size_t> kTradeWidths  = {8, 8, 8, 8, 8, 4, 4, 1};
+const std::vector<std::size_t> kResultWidths = {8, 8, 8, 8, 8, 8, 8, 8};
+
+/**
+ * @brief Round a byte count up to a multiple of 8.
+ */
+std::size_t pad8(std::size_t n)
+{
+    return (n + 7) & ~static_cast<std::size_t>(7);
+}
+
+/**
+ * @brief Bytes taken by a row group of `rows` rows.
+ */
+std::size_t group_bytes(const std::vector<std::size_t>& widths, std::size_t rows)
+{
+    std::size_t bytes = 0;
+    for (const std::size_t w : widths) bytes += pad8(rows * w);
+    return bytes;
+}
+
+/**
+ * @brief Checks shared by every trade reader and sets the option type.
+ *
+ * @param t Parsed trade; its type is set from typeCode.
+ * @param typeCode 1 = Call, 2 = Put, as stored in both file formats.
+ * @param unit "line" (CSV) or "row" (binary), for the error message.
+ * @param n 1-based line or row number.
+ * @throw std::runtime_error on an unknown type or non-positive nPaths/nSteps.
+ */
+void validate_trade(Trade& t, const unsigned typeCode, const char* unit, const std::uint64_t n)
+{
+    const auto fail = [&](const char* what) {
+        throw std::runtime_error("trade file " + std::string(unit) + " " + std::to_string(n)
+                                 + ": " + what);
+    };
+
+    if (typeCode == 1)      t.params.type = LookbackType::Call;
+    else if (typeCode == 2) t.params.type = LookbackType::Put;
+    else fail("unknown option type");
+
+    if (t.params.nPaths < 1 || t.params.nSteps < 1)
+        fail("nPaths and nSteps must be positive");
+}
+
+// -----------------------------------------------------------------------------
+// Binary columnar writer shared by trades and results
+// -----------------------------------------------------------------------------
+
+class ColumnGroupWriter {
+public:
+    ColumnGroupWriter(const std::string& path,
+                      FileKind kind_,
+                      const std::vector<std::size_t>& widths_,
+                      int groupRows_)
+        : out(path, std::ios::binary | std::ios::trunc),
+          kind(kind_),
+          widths(widths_),
+          columns(widths_.size()),
+          groupRows(pad8(static_cast<std::size_t>(std::max(groupRows_, 1))))
+    {
+        if (!out)
+            throw std::runtime_error("cannot create " + path);
+
+        write_header();   // row count is patched in by close()
+        for (std::size_t c = 0; c < columns.size(); ++c)
+            columns[c].reserve(groupRows * widths[c]);
+    }
+
+    /**
+     * @brief Append one cell of the current row.
+     */
+    template <class T>
+    void put(std::size_t col, const T& value)
+    {
+        const auto* bytes = reinterpret_cast<const unsigned char*>(&value);
+        columns[col].insert(columns[col].end(), bytes, bytes + sizeof(T));
+    }
+
+    /**
+     * @brief Finish the current row; full groups are written out.
+     */
+    void end_row()
+    {
+        ++rowsInGroup;
+        ++nRows;
+        if (rowsInGroup == groupRows) flush_group();
+    }
+
+    void close()
+    {
+        if (!out.is_open()) return;
+
+        flush_group();
+        out.seekp(0);
+        write_header();
+        out.close();
+
+        if (!out)
+            throw std::runtime_error("write failed");
+    }
+
+private:
+    void write_header()
+    {
+        ColumnHeader h{};
+        std::memcpy(h.magic, kMagic, sizeof(kMagic));
+        h.headerSize = sizeof(ColumnHeader);
+        h.kind       = static_cast<std::uint32_t>(kind);
+        h.nRows      = nRows;
+        h.groupRows  = groupRows;
+        out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+    }
+
+    void flush_group()
+    {
+        if (rowsInGroup == 0) return;
+
+        static const char zeros[8] = {};
+        for (std::vector<unsigned char>& col : columns)
+        {
+            out.write(reinterpret_cast<const char*>(col.data()),
+                      static_cast<std::streamsize>(col.size()));
+            out.write(zeros, static_cast<std::streamsize>(pad8(col.size()) - col.size()));
+            col.clear();
+        }
+
+        if (!out)
+            throw std::runtime_error("write failed");
+
+        rowsInGroup = 0;
+    }
+
+    std::ofstream out;
+    FileKind kind;
+    std::vector<std::size_t> widths;
+    std::vector<std::vector<unsigned char>> columns;   // current group, per column
+    std::size_t groupRows;
+    std::size_t rowsInGroup = 0;
+    std::uint64_t nRows = 0;
+};
+
+// -----------------------------------------------------------------------------
+// Readers
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Trade reader over a mapped binary columnar file.
+ */
+class BinaryTradeReader : public TradeReader {
+public:
+    explicit BinaryTradeReader(std::unique_ptr<MappedFile> mapped)
+        : file(std::move(mapped))
+    {
+        ColumnHeader h;
+        std::memcpy(&h, file->data(), sizeof(h));
+
+        if (h.headerSize != sizeof(ColumnHeader) ||
+            h.kind != static_cast<std::uint32_t>(FileKind::Trades) ||
+            h.groupRows == 0)
+            throw std::runtime_error("not a binary trade file");
+
+        nRows     = h.nRows;
+        groupRows = h.groupRows;
+
+        const std::uint64_t fullGroups = nRows / groupRows;
+        const std::size_t expected = sizeof(ColumnHeader)
+            + fullGroups * group_bytes(kTradeWidths, groupRows)
+            + group_bytes(kTradeWidths, nRows % groupRows);
+
+        if (file->size() != expected)
+            throw std::runtime_error("binary trade file is truncated");
+    }
+
+    std::size_t read(std::vector<Trade>& out, std::size_t maxRows) override
+    {
+        out.clear();
+
+        while (out.size() < maxRows && row < nRows)
+        {
+            // Locate the group holding `row` and its column starts
+            const std::uint64_t g = row / groupRows;
+            const std::size_t m = static_cast<std::size_t>(
+                std::min<std::uint64_t>(groupRows, nRows - g * groupRows));
+
+            const unsigned char* col[8];
+            const unsigned char* p = file->data() + sizeof(ColumnHeader)
+                                   + g * group_bytes(kTradeWidths, groupRows);
+            for (std::size_t c = 0; c < kTradeWidths.size(); ++c) {
+                col[c] = p;
+                p += pad8(m * kTradeWidths[c]);
+            }
+
+            for (std::size_t j = row - g * groupRows; j < m && out.size() < maxRows; ++j, ++row)
+            {
+                Trade t{};
+                std::uint8_t type;
+                std::memcpy(&t.id,              col[0] + 8 * j, 8);
+                std::memcpy(&t.params.S0,       col[1] + 8 * j, 8);
+                std::memcpy(&t.params.r,        col[2] + 8 * j, 8);
+                std::memcpy(&t.params.sigma,    col[3] + 8 * j, 8);
+                std::memcpy(&t.params.T,        col[4] + 8 * j, 8);
+                std::memcpy(&t.params.nPaths,   col[5] + 4 * j, 4);
+                std::memcpy(&t.params.nSteps,   col[6] + 4 * j, 4);
+                std::memcpy(&type,              col[7] + j, 1);
+
+                validate_trade(t, type, "row", row + 1);
+                out.push_back(t);
+            }
+        }
+
+        return out.size();
+    }
+
+private:
+    std::unique_ptr<MappedFile> file;
+    std::uint64_t nRows = 0;
+    std::uint64_t groupRows = 0;
+    std::uint64_t row = 0;   // next row to read
+};
+
+/**
+ * @brief Trade reader over a mapped CSV file, parsed in place.
+ */
+class CsvTradeReader : public TradeReader {
+public:
+    explicit CsvTradeReader(std::unique_ptr<MappedFile> mapped)
+        : file(std::move(mapped)),
+          pos(reinterpret_cast<const char*>(file->data())),
+          end(pos + file->size())
+    {
+    }
+
+    std::size_t read(std::vector<Trade>& out, std::size_t maxRows) override
+    {
+        out.clear();
+
+        while (out.size() < maxRows && pos < end)
+        {
+            const char* eol = static_cast<const char*>(std::memchr(pos, '\n', end - pos));
+            if (!eol) eol = end;
+
+            const char* lineBegin = pos;
+            const char* lineEnd = eol;
+            pos = (eol < end) ? eol + 1 : end;
+            ++lineNo;
+
+            while (lineEnd > lineBegin && (lineEnd[-1] == '\r' || lineEnd[-1] == ' '))
+                --lineEnd;
+            while (lineBegin < lineEnd && *lineBegin == ' ')
+                ++lineBegin;
+
+            if (lineBegin == lineEnd) continue;
+
+            // Optional header line
+            if (lineNo == 1 && !(*lineBegin >= '0' && *lineBegin <= '9')) continue;
+
+            out.push_back(parse_line(lineBegin, lineEnd));
+        }
+
+        return out.size();
+    }
+
+private:
+    [[noreturn]] void fail(const char* what) const
+    {
+        throw std::runtime_error("trade file line " + std::to_string(lineNo) + ": " + what);
+    }
+
+    /**
+     * @brief Cut the next comma-separated field of [p, e), trimmed.
+     */
+    static std::pair<const char*, const char*> next_field(const char*& p, const char* e)
+    {
+        const char* b = p;
+        while (p < e && *p != ',') ++p;
+        const char* f = p;
+        if (p < e) ++p;
+
+        while (b < f && *b == ' ') ++b;
+        while (f > b && f[-1] == ' ') --f;
+        return {b, f};
+    }
+
+    template <class T>
+    T number(const char*& p, const char* e) const
+    {
+        const auto [b, f] = next_field(p, e);
+        T value{};
+        const auto res = std::from_chars(b, f, value);
+        if (res.ec != std::errc() || res.ptr != f) fail("malformed number");
+        return value;
+    }
+
+    /**
+     * @brief Type code of a whole trimmed field: 1 for 1/C/Call, 2 for 2/P/Put
+     *        (case-insensitive), 0 otherwise.
+     */
+    static unsigned type_code(const char* b, const char* f)
+    {
+        const auto is = [b, f](const char* word) {
+            const std::size_t len = std::strlen(word);
+            if (static_cast<std::size_t>(f - b) != len) return false;
+            for (std::size_t i = 0; i < len; ++i)
+                if (std::tolower(static_cast<unsigned char>(b[i])) != word[i]) return false;
+            return true;
+        };
+
+        if (is("1") || is("c") || is("call")) return 1;
+        if (is("2") || is("p") || is("put"))  return 2;
+        return 0;
+    }
+
+    Trade parse_line(const char* p, const char* e) const
+    {
+        Trade t{};
+        t.id              = number<std::uint64_t>(p, e);
+        t.params.S0       = number<double>(p, e);
+        t.params.r        = number<double>(p, e);
+        t.params.sigma    = number<double>(p, e);
+        t.params.T        = number<double>(p, e);
+
+        const auto [tb, tf] = next_field(p, e);
+        if (tb == tf) fail("missing option type");
+        const unsigned typeCode = type_code(tb, tf);
+
+        t.params.nPaths   = number<int>(p, e);
+        t.params.nSteps   = number<int>(p, e);
+
+        validate_trade(t, typeCode, "line", static_cast<std::uint64_t>(lineNo));
+        return t;
+    }
+
+    std::unique_ptr<MappedFile> file;
+    const char* pos;      // next unread byte
+    const char* end;      // end of mapping
+    long lineNo = 0;      // 1-based number of the last line read
+};
+
+// -----------------------------------------------------------------------------
+// Writers
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Close a text writer's stream, surfacing errors of the final flush.
+ */
+void close_checked(std::ofstream& out)
+{
+    if (!out.is_open()) return;
+
+    out.close();
+    if (!out)
+        throw std::runtime_error("write failed");
+}
+
+class CsvTradeWriter : public TradeWriter {
+public:
+    explicit CsvTradeWriter(const std::string& path)
+        : out(path, std::ios::trunc)
+    {
+        if (!out)
+            throw std::runtime_error("cannot create " + path);
+
+        out.precision(std::numeric_limits<double>::max_digits10);
+        out << "id,S0,r,sigma,T,type,nPaths,nSteps\n";
+    }
+
+    void write(const std::vector<Trade>& trades) override
+    {
+        for (const Trade& t : trades)
+            out << t.id << ',' << t.params.S0 << ',' << t.params.r << ','
+                << t.params.sigma << ',' << t.params.T << ','
+                << (t.params.type == LookbackType::Call ? 1 : 2) << ','
+                << t.params.nPaths << ',' << t.params.nSteps << '\n';
+
+        if (!out)
+            throw std::runtime_error("write failed");
+    }
+
+    void close() override { close_checked(out); }
+
+private:
+    std::ofstream out;
+};
+
+class BinaryTradeWriter : public TradeWriter {
+public:
+    BinaryTradeWriter(const std::string& path, int groupRows)
+        : cols(path, FileKind::Trades, kTradeWidths, groupRows)
+    {
+    }
+
+    void write(const std::vector<Trade>& trades) override
+    {
+        for (const Trade& t : trades)
+        {
+            cols.put(0, t.id);
+            cols.put(1, t.params.S0);
+            cols.put(2, t.params.r);
+            cols.put(3, t.params.sigma);
+            cols.put(4, t.params.T);
+            cols.put(5, static_cast<std::int32_t>(t.params.nPaths));
+            cols.put(6, static_cast<std::int32_t>(t.params.nSteps));
+            cols.put(7, static_cast<std::uint8_t>(t.params.type == LookbackType::Call ? 1 : 2));
+            cols.end_row();
+        }
+    }
+
+    void close() override { cols.close(); }
+
+private:
+    ColumnGroupWriter cols;
+};
+
+class CsvResultWriter : public ResultWriter {
+public:
+    explicit CsvResultWriter(const std::string& path)
+        : out(path, std::ios::trunc)
+    {
+        if (!out)
+            throw std::runtime_error("cannot create " + path);
+
+        out.precision(std::numeric_limits<double>::max_digits10);
+        out << "id,price,stdError,delta,gamma,theta,rho,vega\n";
+    }
+
+    void write(const std::vector<TradeResult>& results) override
+    {
+        for (const TradeResult& res : results)
+        {
+            const Greeks& g = res.greeks;
+            out << res.id << ',' << g.price << ',' << g.stdError << ','
+                << g.delta << ',' << g.gamma << ',' << g.theta << ','
+                << g.rho << ',' << g.vega << '\n';
+        }
+
+        if (!out)
+            throw std::runtime_error("write failed");
+    }
+
+    void close() override { close_checked(out); }
+
+private:
+    std::ofstream out;
+};
+
+class BinaryResultWriter : public ResultWriter {
+public:
+    BinaryResultWriter(const std::string& path, int groupRows)
+        : cols(path, FileKind::Results, kResultWidths, groupRows)
+    {
+    }
+
+    void write(const std::vector<TradeResult>& results) override
+    {
+        for (const TradeResult& res : results)
+        {
+            const Greeks& g = res.greeks;
+            cols.put(0, res.id);
+            cols.put(1, g.price);
+            cols.put(2, g.stdError);
+            cols.put(3, g.delta);
+            cols.put(4, g.gamma);
+            cols.put(5, g.theta);
+            cols.put(6, g.rho);
+            cols.put(7, g.vega);
+            cols.end_row();
+        }
+    }
+
+    void close() override { cols.close(); }
+
+private:
+    ColumnGroupWriter cols;
+};
+
+} // namespace
+
+/**
+ * @brief Format implied by a file name.
+ */
+FileFormat format_from_path(const std::string& path)
+{
+    const std::string ext = ".csv";
+    const bool isCsv = path.size() >= ext.size()
+        && std::equal(ext.begin(), ext.end(), path.end() - ext.size(),
+                      [](char a, char b) { return a == std::tolower(static_cast<unsigned char>(b)); });
+
+    return isCsv ? FileFormat::CSV : FileFormat::Binary;
+}
+
+/**
+ * @brief Map a trade file and pick the reader matching its content.
+ */
+std::unique_ptr<TradeReader> open_trade_reader(const std::string& path)
+{
+    auto file = std::make_unique<MappedFile>(path);
+
+    const bool binary = file->size() >= sizeof(ColumnHeader)
+        && std::memcmp(file->data(), kMagic, sizeof(kMagic)) == 0;
+
+    if (binary)
+        return std::make_unique<BinaryTradeReader>(std::move(file));
+
+    return std::make_unique<CsvTradeReader>(std::move(file));
+}
+
+/**
+ * @brief Create a trade file.
+ */
+std::unique_ptr<TradeWriter> open_trade_writer(const std::string& path,
+                                               const FileFormat format,
+                                               const int groupRows)
+{
+    if (format == FileFormat::CSV)
+        return std::make_unique<CsvTradeWriter>(path);
+
+    return std::make_unique<BinaryTradeWriter>(path, groupRows);
+}
+
+/**
+ * @brief Create a result file.
+ */
+std::unique_ptr<ResultWriter> open_result_writer(const std::string& path,
+                                                 const FileFormat format,
+                                                 const int groupRows)
+{
+    if (format == FileFormat::CSV)
+        return std::make_unique<CsvResultWriter>(path);
+
+    return std::make_unique<BinaryResultWriter>(path, groupRows);
+}
@@ -3,12 +3,16 @@
 #include <string>
 #include <cmath>
 #include <filesystem>
+#include <memory>
+#include <stdexcept>
 
 namespace fs = std::filesystem;
 
 #include "LookbackOption.h"
 #include "Greeks.h"
 #include "ExactLookbackPrice.h"
+#include "NormalCube.h"
+#include "BatchPricer.h"
 
 /**
  * @file main.cpp
@@ -16,12 +20,103 @@ namespace fs = std::filesystem;
  *        and Greeks, and writes results to files.
  */
 
+/**
+ * @brief Write the results file through a temporary file and a rename, so
+ *        readers polling it never see a partially written update.
+ *
+ * @param path Results file.
+ * @param exactPrice Closed-form price.
+ * @param g Monte Carlo price and Greeks.
+ * @param nPaths Paths behind `g`; when > 0 (progressive mode) the standard
+ *               error and path count are appended as lines 8 and 9.
+ * @return False if the file could not be written or replaced (e.g. it is
+ *         held open), in which case the previous contents are kept.
+ */
+static bool write_results(const std::string& path,
+                          const double exactPrice,
+                          const Greeks& g,
+                          const int nPaths)
+{
+    const std::string tmpPath = path + ".tmp";
+
+    std::ofstream out(tmpPath);
+    out << exactPrice << "\n"
+        << g.price << "\n"
+        << g.delta << "\n"
+        << g.gamma << "\n"
+        << g.theta << "\n"
+        << g.rho   << "\n"
+        << g.vega  << "\n";
+
+    if (nPaths > 0) {
+        out << g.stdError << "\n"
+            << nPaths     << "\n";
+    }
+    out.close();
+
+    std::error_code ec;
+    if (out) fs::rename(tmpPath, path, ec);
+
+    if (!out || ec) {
+        fs::remove(tmpPath, ec);
+        return false;
+    }
+    return true;
+}
+
 /**
  * @brief Program entry point.
+ *
+ * Usage: `Lookback [--cube <file>] [--progressive]`
+ *    or: `Lookback --batch <trades> <results>`.
+ *
+ * With `--cube`, the normal increments are generated once into `<file>` (or
+ * reused if it already matches the run) and memory-mapped by every
+ * Black-Scholes repricing; the pathwise Delta/Vega run of each Greeks call
+ * still draws its own stream.
+ *
+ * With `--progressive`, excel_results.txt is replaced at geometric path
+ * milestones with the current estimates, their standard error and path
+ * count. Creating excel_cancel.txt stops the refinement within a block of
+ * paths; the curves are then computed with the number of paths reached.
+ *
+ * With `--batch`, every trade of `<trades>` (CSV or binary columnar) is
+ * priced in a parallel pipeline and the results are streamed to
+ * `<results>` (CSV if it ends in .csv, binary columnar otherwise).
+ *
+ * @param argc Number of command-line arguments.
+ * @param argv Command-line arguments.
  * @return Exit code (0 = success).
  */
-int main()
+int main(int argc, char* argv[])
 {
+    std::string cubePath;
+    bool progressive = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--cube" && i + 1 < argc) {
+            cubePath = argv[++i];
+        } else if (arg == "--progressive") {
+            progressive = true;
+        } else if (arg == "--batch" && i + 2 < argc) {
+            const std::string tradesPath  = argv[++i];
+            const std::string resultsPath = argv[++i];
+
+            try {
+                price_trade_file(tradesPath, resultsPath, format_from_path(resultsPath));
+            } catch (const std::exception& e) {
+                std::cerr << "ERROR: batch " << tradesPath << ": " << e.what() << "\n";
+                return 1;
+            }
+            return 0;
+        } else {
+            std::cerr << "usage: " << argv[0] << " [--cube <file>] [--progressive]\n"
+                      << "       " << argv[0] << " --batch <trades> <results>\n";
+            return 1;
+        }
+    }
+
     // -------------------------------------------------------------------------
     // Define base path for input and output files
     // Files are read from and written to the executable directory
@@ -83,22 +178,87 @@ int main()
     // -------------------------------------------------------------------------
     const unsigned long seed = 12345UL;
 
-    Greeks g = compute_greeks_MC(params,
-                                 1.0,           // bump in S
-                                 0.0001,        // bump in sigma
-                                 0.01,          // bump in r
-                                 1.0 / 365.0,   // bump in T
-                                 seed);
+    // -------------------------------------------------------------------------
+    // Optional pre-generated normal cube shared by all repricings below
+    // -------------------------------------------------------------------------
+    std::unique_ptr<NormalCube> cube;
 
-    std::ofstream out(basePath + "/excel_results.txt");
-    out << exactPrice << "\n"
-        << g.price << "\n"
-        << g.delta << "\n"
-        << g.gamma << "\n"
-        << g.theta << "\n"
-        << g.rho   << "\n"
-        << g.vega  << "\n";
-    out.close();
+    if (!cubePath.empty()) {
+        try {
+            // An existing but unreadable cube is simply regenerated
+            if (fs::exists(cubePath)) {
+                try { cube = std::make_unique<NormalCube>(cubePath); }
+                catch (const std::runtime_error&) { cube.reset(); }
+            }
+
+            if (!cube || !cube->matches(seed, params.nPaths, params.nSteps, CubeRng::MT19937)) {
+                cube.reset();
+                NormalCube::generate(cubePath, seed, params.nPaths, params.nSteps);
+                cube = std::make_unique<NormalCube>(cubePath);
+            }
+        } catch (const std::exception& e) {
+            std::cerr << "ERROR: normal cube " << cubePath << ": " << e.what() << "\n";
+            return 1;
+        }
+
+        params.cube = cube.get();
+    }
+
+    const std::string resultsPath = basePath + "/excel_results.txt";
+
+    Greeks g{};
+
+    if (progressive) {
+        const std::string cancelPath = basePath + "/excel_cancel.txt";
+        std::error_code ec;
+        fs::remove(cancelPath, ec);
+
+        int reachedPaths = params.nPaths;
+        bool written = false;
+
+        g = compute_greeks_MC_progressive(
+                params,
+                1.0,           // bump in S
+                0.0001,        // bump in sigma
+                0.01,          // bump in r
+                1.0 / 365.0,   // bump in T
+                seed,
+                progressive_milestones(params.nPaths),
+                [&](const GreeksProgress& u) {
+                    // A failed update is skipped; the next one may succeed
+                    written = write_results(resultsPath, exactPrice, u.greeks, u.nPaths);
+                    reachedPaths = u.nPaths;
+                    return true;
+                },
+                [&] {
+                    std::error_code ignored;
+                    return fs::exists(cancelPath, ignored);
+                });
+
+        if (fs::exists(cancelPath, ec)) {
+            // Good enough: keep this accuracy for the curves too
+            fs::remove(cancelPath, ec);
+        }
+
+        params.nPaths = reachedPaths;
+
+        if (!written) {
+            std::cerr << "ERROR: cannot write " << resultsPath << "\n";
+            return 1;
+        }
+    } else {
+        g = compute_greeks_MC(params,
+                              1.0,           // bump in S
+                              0.0001,        // bump in sigma
+                              0.01,          // bump in r
+                              1.0 / 365.0,   // bump in T
+                              seed);
+
+        if (!write_results(resultsPath, exactPrice, g, 0)) {
+            std::cerr << "ERROR: cannot write " << resultsPath << "\n";
+            return 1;
+        }
+    }
 
     // -------------------------------------------------------------------------
     // Price curve as a function of the initial spot